@@ -1,7 +1,5 @@
 ﻿
 #include "SaveGSystemDataTypes.h"
-#include "EngineUtils.h"
-#include "SaveGSystem/Interface/SaveGInterface.h"
 #include "SaveGSystem/SubSystem/SaveGSubSystem.h"
 
 #if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
@@ -15,14 +13,7 @@ static FAutoConsoleCommandWithWorldAndArgs EnableD_SaveGSystemSaveAllWorldActor(
         {
             USaveGSubSystem* SaveGSubSystem = USaveGSubSystem::Get(World);
             if (!SaveGSubSystem) return;
-            for (FActorIterator It(World); It; ++It)
-            {
-                AActor* Actor = *It;
-                if (!Actor) continue;
-                if (!Actor->GetClass()) continue;
-                if (!Actor->GetClass()->ImplementsInterface(USaveGInterface::StaticClass())) continue;
-                SaveGSubSystem->UpdateSaveData(Actor->GetName(), Actor);
-            }
+            SaveGSubSystem->SaveWorld(World);
         }),
     ECVF_Cheat);
 
@@ -33,14 +24,7 @@ static FAutoConsoleCommandWithWorldAndArgs EnableD_SaveGSystemLoadAllWorldActor(
         {
             USaveGSubSystem* SaveGSubSystem = USaveGSubSystem::Get(World);
             if (!SaveGSubSystem) return;
-            for (FActorIterator It(World); It; ++It)
-            {
-                AActor* Actor = *It;
-                if (!Actor) continue;
-                if (!Actor->GetClass()) continue;
-                if (!Actor->GetClass()->ImplementsInterface(USaveGInterface::StaticClass())) continue;
-                SaveGSubSystem->LoadSaveData(Actor->GetName(), Actor);
-            }
+            SaveGSubSystem->LoadWorld(World);
         }),
     ECVF_Cheat);
 
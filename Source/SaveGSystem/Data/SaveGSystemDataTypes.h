@@ -1,6 +1,8 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Misc/EnumRange.h"
 #include "SaveGSystemDataTypes.generated.h"
 
 /** --- | LOGGING | --- **/
@@ -43,6 +45,57 @@ inline bool ClogPrint(bool Cond, TCHAR* NameFunction, const FString& Text)
 
 #define CLOG_SAVE_G_SYSTEM(Cond, Format, ...) SaveGSystemSpace::ClogPrint(Cond, ANSI_TO_TCHAR(__FUNCTION__), FString::Printf(TEXT(Format), ##__VA_ARGS__))
 
+/** --- | CONSTANTS | --- **/
+
+namespace SaveGSystemSpace
+{
+/** Version of the tagged binary stream of a single tag. Version 2 writes names as indices into a name table, version 3 adds flags,
+ * version 4 stores arrays of structs by column, version 5 stores maps by column and adds sets **/
+constexpr uint16 BinaryVersion = 5;
+
+/** Flag of a tagged binary stream whose properties equal to the defaults are omitted **/
+constexpr uint8 BinaryFlagSkipDefaults = 1 << 0;
+
+/** Magic number at the start of a binary save container ('SAVG') **/
+constexpr uint32 BinaryFileMagic = 0x47564153;
+
+/** Version of the binary save container. Version 2 stores a global name table shared by all tags **/
+constexpr uint16 BinaryFileVersion = 2;
+
+/** Flag on the element type of an array whose elements are stored as one raw memory block **/
+constexpr uint8 PackedArrayFlag = 0x80;
+
+/** Flag on the element type of an array of structs whose fields are stored column by column, or on the key type of a map whose keys and values are stored as two columns **/
+constexpr uint8 ColumnarArrayFlag = 0x40;
+
+/** Magic number at the start of chunk-compressed data ('SGCZ'). Data without it is a single Zlib stream of an older version **/
+constexpr uint32 CompressedMagic = 0x5A434753;
+
+/** Version of the chunk-compressed data header. Version 3 adds the flags, version 2 records the codec, version 1 data is always Zlib **/
+constexpr uint16 CompressedVersion = 3;
+
+/** Offset of the codec in the chunk-compressed data header, right after the magic number and the version **/
+constexpr int32 CompressedCodecOffset = sizeof(uint32) + sizeof(uint16);
+
+/** Flag of the chunk-compressed data header: the payload did not get smaller and follows the header uncompressed, without a chunk table **/
+constexpr uint8 CompressedRawFlag = 0x01;
+
+/** Size of the independently compressed chunks of a payload **/
+constexpr int32 CompressionChunkSize = 256 * 1024;
+
+/** Magic number at the start of an indexed save file ('SGIX'). Files without it hold one compressed container **/
+constexpr uint32 IndexedFileMagic = 0x58494753;
+
+/** Version of the indexed save file **/
+constexpr uint16 IndexedFileVersion = 1;
+
+/** Tags are grouped into one block until the group holds this many bytes of tag data, a larger tag gets a block of its own **/
+constexpr int32 IndexedBlockSize = 64 * 1024;
+
+/** Number of actors checked for the interface in one step of gathering the participants of SaveWorld/LoadWorld **/
+constexpr int32 WorldGatherChunkSize = 256;
+}  // namespace SaveGSystemSpace
+
 /** --- | UENUM | --- **/
 UENUM()
 enum class ETaskAction_SaveGSystem : uint8
@@ -52,24 +105,191 @@ enum class ETaskAction_SaveGSystem : uint8
     Load,
 };
 
+/** @enum Format in which the properties of an object are serialized **/
+UENUM(BlueprintType)
+enum class ESerializeFormat_SaveGSystem : uint8
+{
+    Json = 0,
+    Binary,
+};
+
+/** @enum Codec used to compress the chunks of a save payload. The value is stored in the data, keep the order **/
+UENUM(BlueprintType)
+enum class ECompressionCodec_SaveGSystem : uint8
+{
+    Zlib = 0,
+    Gzip,
+    LZ4,
+    OodleKraken,
+    OodleMermaid,
+    OodleSelkie,
+};
+ENUM_RANGE_BY_FIRST_AND_LAST(ECompressionCodec_SaveGSystem, ECompressionCodec_SaveGSystem::Zlib, ECompressionCodec_SaveGSystem::OodleSelkie);
+
+/** @enum Trade-off between compression speed and size **/
+UENUM(BlueprintType)
+enum class ECompressionLevel_SaveGSystem : uint8
+{
+    Fastest = 0,
+    Normal,
+    Smallest,
+};
+ENUM_RANGE_BY_FIRST_AND_LAST(ECompressionLevel_SaveGSystem, ECompressionLevel_SaveGSystem::Fastest, ECompressionLevel_SaveGSystem::Smallest);
+
+/** @enum Type of a property inside the tagged binary stream **/
+UENUM()
+enum class EPropertyType_SaveGSystem : uint8
+{
+    None = 0,
+    Bool,
+    Byte,
+    Enum,
+    Int8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float,
+    Double,
+    Str,
+    Name,
+    Text,
+    SoftClass,
+    SoftObject,
+    Struct,
+    Array,
+    Map,
+    Set,
+};
+
 /** --- | STRUCT | --- **/
 
-/** @struct Data for the operation of asynс task **/
+/** @struct Serialized data of a single tag **/
+struct FTagData_SaveGSystem
+{
+    ESerializeFormat_SaveGSystem Format{ESerializeFormat_SaveGSystem::Json};
+    TArray<uint8> Data{};
+
+    /** Names referenced by index from the binary data **/
+    TArray<FName> Names{};
+
+    /** Binary properties equal to the class or struct defaults are not written **/
+    bool bSkipDefaultValues{false};
+};
+
+/** Stored tag data is never changed in place, so it can be shared with file writers on other threads **/
+using FTagDataRef_SaveGSystem = TSharedRef<const FTagData_SaveGSystem, ESPMode::ThreadSafe>;
+
+/** Tags with their stored data **/
+using FTagDataMap_SaveGSystem = TMap<FString, FTagDataRef_SaveGSystem>;
+
+/** @struct Independently compressed block of an indexed save file, holding a binary container of a group of tags **/
+struct FSaveFileBlock_SaveGSystem
+{
+    /** Offset from the end of the table of contents **/
+    int64 Offset{0};
+    int32 Length{0};
+
+    /** CRC32 of the stored bytes **/
+    uint32 Checksum{0};
+
+    /** Codec the block is compressed with. The compressed data records it as well, a block whose header disagrees is rejected as corrupted **/
+    uint8 Codec{0};
+
+    friend FArchive& operator<<(FArchive& Ar, FSaveFileBlock_SaveGSystem& Block)
+    {
+        Ar << Block.Offset;
+        Ar << Block.Length;
+        Ar << Block.Checksum;
+        Ar << Block.Codec;
+        return Ar;
+    }
+};
+
+/** @struct Entry of the table of contents of an indexed save file **/
+struct FSaveFileTocEntry_SaveGSystem
+{
+    FString Tag{};
+    int32 BlockIndex{INDEX_NONE};
+
+    friend FArchive& operator<<(FArchive& Ar, FSaveFileTocEntry_SaveGSystem& Entry)
+    {
+        Ar << Entry.Tag;
+        Ar << Entry.BlockIndex;
+        return Ar;
+    }
+};
+
+class FSaveGPropertySnapshot;
+
+/** Promise of a caller waiting for a single save/load request **/
+using FRequestPromiseRef_SaveGSystem = TSharedRef<TPromise<bool>, ESPMode::ThreadSafe>;
+
+/** @struct Queued save/load request of the subsystem **/
 struct FInitDataAsyncTask_SaveGSystem
 {
     ETaskAction_SaveGSystem Action{ETaskAction_SaveGSystem::None};
-    float Delay{5.0f};
     FString Tag{};
     TWeakObjectPtr<> Object{nullptr};
-    FString JsonSaveData{};
+    FTagData_SaveGSystem SaveData{};
+
+    /** Properties copied by the producer of a save, the object is not touched then **/
+    TSharedPtr<const FSaveGPropertySnapshot, ESPMode::ThreadSafe> Snapshot{};
+
+    /** Order in which the data of saves was taken, 0 until it is. Data older than the stored one of the tag is dropped **/
+    uint64 Generation{0};
+
+    /** Set once the request is done, true if it was carried out. A save that replaces a pending one takes over its promises **/
+    TArray<FRequestPromiseRef_SaveGSystem> Promises{};
+
+    void ResolvePromises(bool bSuccess)
+    {
+        for (const FRequestPromiseRef_SaveGSystem& Promise : Promises)
+        {
+            Promise->SetValue(bSuccess);
+        }
+        Promises.Reset();
+    }
 
     UObject* GetObject() const { return Object.Get(); }
 
     UClass* GetObjectClass() const { return Object.IsValid() ? Object->GetClass() : nullptr; }
 
-    bool IsValid() const { return Object.IsValid() && Object->GetClass() && !Tag.IsEmpty() && Action != ETaskAction_SaveGSystem::None && Delay > 0.0f; }
+    bool IsValid() const
+    {
+        const bool bHasSource = Snapshot.IsValid() || (Object.IsValid() && Object->GetClass());
+        return bHasSource && !Tag.IsEmpty() && Action != ETaskAction_SaveGSystem::None;
+    }
+};
+
+class UWorld;
+
+/** @struct State of a time-sliced SaveWorld/LoadWorld **/
+struct FWorldAction_SaveGSystem
+{
+    ETaskAction_SaveGSystem Action{ETaskAction_SaveGSystem::None};
+    TWeakObjectPtr<UWorld> World{nullptr};
+
+    /** Position of the next actor to check while the participants are gathered **/
+    int32 LevelIndex{0};
+    int32 ActorIndex{0};
+    bool bGathered{false};
+
+    /** Actors implementing the interface, processed in order **/
+    TArray<TWeakObjectPtr<>> Participants{};
+    int32 NumProcessed{0};
+
+    bool IsActive() const { return Action != ETaskAction_SaveGSystem::None; }
+
+    /** Gathering counts as nothing done, the actors are the progress **/
+    float GetProgress() const { return bGathered ? (Participants.Num() > 0 ? static_cast<float>(NumProcessed) / Participants.Num() : 1.0f) : 0.0f; }
 };
 
 /** --- | Signatures | --- **/
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FActionSaveGSystemSignature, const FString&, Tag, UObject*, SavedObject);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFileActionSaveGSystemSignature, const FString&, FileName, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FWorldProgressSaveGSystemSignature, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FWorldActionSaveGSystemSignature, bool, bSave, int32, NumActors);
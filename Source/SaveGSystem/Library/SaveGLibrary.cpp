@@ -1,33 +1,480 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "SaveGLibrary.h"
+#include "Algo/AnyOf.h"
+#include "Async/ParallelFor.h"
 #include "Compression/CompressedBuffer.h"
+#include "Compression/OodleDataCompression.h"
+#include "Misc/Compression.h"
+#include "Misc/Base64.h"
 #include "SaveGSystem/Data/SaveGSystemDataTypes.h"
+#include "SaveGSystem/Library/SaveGNameTableArchive.h"
+#include "SaveGSystem/Library/SaveGPropertyPlan.h"
+#include "SaveGSystem/Library/SaveGPropertySnapshot.h"
+#include "SaveGSystem/Settings/SaveGSettings.h"
 #include "Serialization/ArchiveLoadCompressedProxy.h"
 #include "Serialization/ArchiveSaveCompressedProxy.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include <atomic>
 
-bool USaveGLibrary::CompressData(TArray<uint8>& SomeData, TArray<uint8>& OutData)
+namespace
+{
+template <typename PropertyType>
+bool SerializeNumericValue(FProperty* Property, const void* ObjectData, FArchive& Ar)
+{
+    if (const PropertyType* TypedProperty = CastField<PropertyType>(Property))
+    {
+        typename PropertyType::TCppType Value = TypedProperty->GetPropertyValue_InContainer(ObjectData);
+        Ar << Value;
+        return true;
+    }
+    return false;
+}
+
+template <typename PropertyType>
+bool DeserializeNumericValue(FProperty* Property, void* ObjectData, FArchive& Ar)
+{
+    if (const PropertyType* TypedProperty = CastField<PropertyType>(Property))
+    {
+        typename PropertyType::TCppType Value{};
+        Ar << Value;
+        TypedProperty->SetPropertyValue_InContainer(ObjectData, Value);
+        return true;
+    }
+    return false;
+}
+
+// Every value in the binary stream takes at least one byte, which bounds the element count of a container
+bool IsValidContainerNum(FArchive& Ar, int32 Num)
+{
+    if (Num < 0 || Num > Ar.TotalSize() - Ar.Tell())
+    {
+        Ar.SetError();
+        return false;
+    }
+    return true;
+}
+
+// Writes the value of a property for each of Num containers, plain values go as raw memory behind their size and layout hash
+template <typename ContainerFuncType>
+void SerializeValueColumn(FProperty* Property, EPropertyType_SaveGSystem Type, bool bPacked, int32 Num, ContainerFuncType GetContainer, FArchive& Ar, bool bSkipDefaults)
+{
+    if (bPacked)
+    {
+        int32 ElementSize = Property->GetSize();
+        uint32 LayoutHash = FSaveGPropertyPlan::GetLayoutHash(Property);
+        Ar << ElementSize;
+        Ar << LayoutHash;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Ar.Serialize(Property->ContainerPtrToValuePtr<void>(GetContainer(Index)), ElementSize);
+        }
+        return;
+    }
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        USaveGLibrary::SerializePropertyValue(Property, Type, GetContainer(Index), Ar, bSkipDefaults);
+    }
+}
+
+// Returns false without reading the values if a packed column no longer matches the size or layout of the property
+template <typename ContainerFuncType>
+bool DeserializeValueColumn(FProperty* Property, EPropertyType_SaveGSystem Type, bool bPacked, int32 Num, ContainerFuncType GetContainer, FArchive& Ar, bool bSkipDefaults)
+{
+    if (bPacked)
+    {
+        int32 ElementSize = 0;
+        uint32 LayoutHash = 0;
+        Ar << ElementSize;
+        Ar << LayoutHash;
+        if (!FSaveGPropertyPlan::IsBulkCopyable(Property) || ElementSize != Property->GetSize() || LayoutHash != FSaveGPropertyPlan::GetLayoutHash(Property))
+        {
+            return false;
+        }
+        if (static_cast<int64>(Num) * ElementSize > Ar.TotalSize() - Ar.Tell())
+        {
+            Ar.SetError();
+            return false;
+        }
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Ar.Serialize(Property->ContainerPtrToValuePtr<void>(GetContainer(Index)), ElementSize);
+        }
+        return !Ar.IsError();
+    }
+    for (int32 Index = 0; Index < Num && !Ar.IsError(); ++Index)
+    {
+        USaveGLibrary::DeserializePropertyValue(Property, Type, GetContainer(Index), Ar, bSkipDefaults);
+    }
+    return !Ar.IsError();
+}
+
+// Numeric, bool and enum array elements are stored as plain JSON values instead of wrapper objects
+bool IsScalarJsonProperty(const FProperty* Property)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property)) return BoolProperty->IsNativeBool();
+    return Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>();
+}
+
+TSharedPtr<FJsonValue> MakeScalarJsonValue(const FProperty* Property, const void* ValuePtr)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        return MakeShared<FJsonValueBoolean>(BoolProperty->GetPropertyValue(ValuePtr));
+    }
+    const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        NumericProperty = EnumProperty->GetUnderlyingProperty();
+    }
+    if (!NumericProperty) return nullptr;
+    if (NumericProperty->IsFloatingPoint())
+    {
+        return MakeShared<FJsonValueNumber>(NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+    }
+    return MakeShared<FJsonValueNumber>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+}
+
+void WriteScalarJsonValue(FSaveGJsonWriter& Writer, const FProperty* Property, const void* ValuePtr)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        Writer.WriteValue(BoolProperty->GetPropertyValue(ValuePtr));
+        return;
+    }
+    const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        NumericProperty = EnumProperty->GetUnderlyingProperty();
+    }
+    if (!NumericProperty)
+    {
+        Writer.WriteNull();
+    }
+    else if (NumericProperty->IsFloatingPoint())
+    {
+        Writer.WriteValue(NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+    }
+    else
+    {
+        Writer.WriteValue(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+    }
+}
+
+// Consumes the rest of a JSON value whose first token was already read
+bool SkipJsonValue(FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (Notation == EJsonNotation::ObjectStart) return Reader.SkipObject();
+    if (Notation == EJsonNotation::ArrayStart) return Reader.SkipArray();
+    return Notation != EJsonNotation::Error;
+}
+
+bool ReadScalarJsonValue(const FProperty* Property, void* ValuePtr, FSaveGJsonReader& Reader, EJsonNotation Notation)
 {
-    // Compress the data
-    FArchiveSaveCompressedProxy Compressor(OutData, NAME_Zlib);
-    if (Compressor.IsError()) return false;
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        if (Notation != EJsonNotation::Boolean) return false;
+        BoolProperty->SetPropertyValue(ValuePtr, Reader.GetValueAsBoolean());
+        return true;
+    }
+    const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        NumericProperty = EnumProperty->GetUnderlyingProperty();
+    }
+    if (!NumericProperty || Notation != EJsonNotation::Number) return false;
+    if (NumericProperty->IsFloatingPoint())
+    {
+        NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Reader.GetValueAsNumber());
+    }
+    else
+    {
+        NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(Reader.GetValueAsNumber()));
+    }
+    return true;
+}
 
-    // Serialize the uncompressed data into the compressor
-    Compressor << SomeData;
-    Compressor.Flush();
+bool SetScalarJsonValue(const FProperty* Property, void* ValuePtr, const TSharedPtr<FJsonValue>& JsonValue)
+{
+    if (!JsonValue.IsValid()) return false;
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        bool Value = false;
+        if (!JsonValue->TryGetBool(Value)) return false;
+        BoolProperty->SetPropertyValue(ValuePtr, Value);
+        return true;
+    }
+    const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        NumericProperty = EnumProperty->GetUnderlyingProperty();
+    }
+    if (!NumericProperty) return false;
+    if (NumericProperty->IsFloatingPoint())
+    {
+        double Value = 0.0;
+        if (!JsonValue->TryGetNumber(Value)) return false;
+        NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Value);
+        return true;
+    }
+    int64 Value = 0;
+    if (!JsonValue->TryGetNumber(Value)) return false;
+    NumericProperty->SetIntPropertyValue(ValuePtr, Value);
     return true;
 }
 
+// Runs Body for every chunk, spreading the chunks round-robin over at most NumWorkers threads
+void ParallelForChunks(int32 NumChunks, int32 NumWorkers, TFunctionRef<void(int32)> Body)
+{
+    const int32 MaxWorkers = NumWorkers > 0 ? NumWorkers : FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+    const int32 NumBatches = FMath::Clamp(MaxWorkers, 1, FMath::Max(NumChunks, 1));
+    ParallelFor(
+        NumBatches,
+        [&](int32 Batch)
+        {
+            for (int32 ChunkIndex = Batch; ChunkIndex < NumChunks; ChunkIndex += NumBatches)
+            {
+                Body(ChunkIndex);
+            }
+        },
+        NumBatches == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+bool IsOodleCodec(ECompressionCodec_SaveGSystem Codec)
+{
+    return Codec == ECompressionCodec_SaveGSystem::OodleKraken || Codec == ECompressionCodec_SaveGSystem::OodleMermaid ||
+           Codec == ECompressionCodec_SaveGSystem::OodleSelkie;
+}
+
+FName GetCompressionFormatName(ECompressionCodec_SaveGSystem Codec)
+{
+    switch (Codec)
+    {
+        case ECompressionCodec_SaveGSystem::Gzip: return NAME_Gzip;
+        case ECompressionCodec_SaveGSystem::LZ4: return NAME_LZ4;
+        default: return NAME_Zlib;
+    }
+}
+
+FOodleDataCompression::ECompressor GetOodleCompressor(ECompressionCodec_SaveGSystem Codec)
+{
+    switch (Codec)
+    {
+        case ECompressionCodec_SaveGSystem::OodleMermaid: return FOodleDataCompression::ECompressor::Mermaid;
+        case ECompressionCodec_SaveGSystem::OodleSelkie: return FOodleDataCompression::ECompressor::Selkie;
+        default: return FOodleDataCompression::ECompressor::Kraken;
+    }
+}
+
+// FCompression codecs only take a speed/size bias, Oodle gets a real level
+ECompressionFlags GetCompressionFlags(ECompressionLevel_SaveGSystem Level)
+{
+    switch (Level)
+    {
+        case ECompressionLevel_SaveGSystem::Fastest: return COMPRESS_BiasSpeed;
+        case ECompressionLevel_SaveGSystem::Smallest: return COMPRESS_BiasSize;
+        default: return COMPRESS_NoFlags;
+    }
+}
+
+FOodleDataCompression::ECompressionLevel GetOodleLevel(ECompressionLevel_SaveGSystem Level)
+{
+    switch (Level)
+    {
+        case ECompressionLevel_SaveGSystem::Fastest: return FOodleDataCompression::ECompressionLevel::SuperFast;
+        case ECompressionLevel_SaveGSystem::Smallest: return FOodleDataCompression::ECompressionLevel::Optimal2;
+        default: return FOodleDataCompression::ECompressionLevel::Normal;
+    }
+}
+
+// Compresses one chunk into OutChunk, which is left empty on failure
+void CompressChunk(ECompressionCodec_SaveGSystem Codec, ECompressionLevel_SaveGSystem Level, const uint8* Data, int32 Size, TArray<uint8>& OutChunk)
+{
+    if (IsOodleCodec(Codec))
+    {
+        const int64 Bound = FOodleDataCompression::CompressedBufferSizeNeeded(Size);
+        OutChunk.SetNumUninitialized(Bound);
+        const int64 CompressedSize =
+            FOodleDataCompression::Compress(OutChunk.GetData(), Bound, Data, Size, GetOodleCompressor(Codec), GetOodleLevel(Level));
+        OutChunk.SetNum(CompressedSize, EAllowShrinking::No);
+        return;
+    }
+
+    const FName FormatName = GetCompressionFormatName(Codec);
+    const ECompressionFlags Flags = GetCompressionFlags(Level);
+    int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, Size, Flags);
+    OutChunk.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(FormatName, OutChunk.GetData(), CompressedSize, Data, Size, Flags))
+    {
+        CompressedSize = 0;
+    }
+    OutChunk.SetNum(CompressedSize, EAllowShrinking::No);
+}
+
+bool DecompressChunk(ECompressionCodec_SaveGSystem Codec, uint8* OutData, int32 Size, const uint8* CompressedData, int32 CompressedSize)
+{
+    if (IsOodleCodec(Codec))
+    {
+        return FOodleDataCompression::Decompress(OutData, Size, CompressedData, CompressedSize);
+    }
+    return FCompression::UncompressMemory(GetCompressionFormatName(Codec), OutData, Size, CompressedData, CompressedSize);
+}
+}  // namespace
+
+bool USaveGLibrary::CompressData(TArray<uint8>& SomeData, TArray<uint8>& OutData)
+{
+    return CompressDataParallel(SomeData, OutData, USaveGSettings::GetCompressionCodecStatic(), USaveGSettings::GetCompressionLevelStatic());
+}
+
 bool USaveGLibrary::DecompressData(const TArray<uint8>& CompressedData, TArray<uint8>& OutData)
 {
-    FArchiveLoadCompressedProxy Decompressor(CompressedData, NAME_Zlib);
-    if (Decompressor.IsError()) return false;
+    return DecompressDataParallel(CompressedData, OutData);
+}
+
+bool USaveGLibrary::CompressDataParallel(TConstArrayView<uint8> Data, TArray<uint8>& OutData, ECompressionCodec_SaveGSystem Codec,
+    ECompressionLevel_SaveGSystem Level, int32 NumWorkers)
+{
+    const int32 ChunkSize = SaveGSystemSpace::CompressionChunkSize;
+    const int32 RawSize = Data.Num();
+    const int32 NumChunks = FMath::DivideAndRoundUp(RawSize, ChunkSize);
+
+    // A chunk that fails to compress is left empty, a non-empty chunk never compresses to zero bytes
+    TArray<TArray<uint8>> Chunks;
+    Chunks.SetNum(NumChunks);
+    ParallelForChunks(NumChunks, NumWorkers,
+        [&](int32 ChunkIndex)
+        {
+            const int32 Offset = ChunkIndex * ChunkSize;
+            const int32 Size = FMath::Min(ChunkSize, RawSize - Offset);
+            CompressChunk(Codec, Level, Data.GetData() + Offset, Size, Chunks[ChunkIndex]);
+        });
+    if (CLOG_SAVE_G_SYSTEM(Algo::AnyOf(Chunks, [](const TArray<uint8>& Chunk) { return Chunk.IsEmpty(); }), "Failed to compress data")) return false;
+
+    // Already compressed or random data is stored as is, the loader then only copies it
+    int64 StoredSize = static_cast<int64>(NumChunks) * sizeof(int32);
+    for (const TArray<uint8>& Chunk : Chunks)
+    {
+        StoredSize += Chunk.Num();
+    }
+    const bool bStoreRaw = RawSize > 0 && StoredSize >= RawSize;
+
+    OutData.Reset();
+    FMemoryWriter Writer(OutData);
+    uint32 Magic = SaveGSystemSpace::CompressedMagic;
+    uint16 Version = SaveGSystemSpace::CompressedVersion;
+    uint8 CodecValue = static_cast<uint8>(Codec);
+    uint8 Flags = bStoreRaw ? SaveGSystemSpace::CompressedRawFlag : 0;
+    int32 ChunkSizeValue = ChunkSize;
+    int32 RawSizeValue = RawSize;
+    int32 NumChunksValue = bStoreRaw ? 0 : NumChunks;
+    Writer << Magic;
+    Writer << Version;
+    Writer << CodecValue;
+    Writer << Flags;
+    Writer << ChunkSizeValue;
+    Writer << RawSizeValue;
+    Writer << NumChunksValue;
+    if (bStoreRaw)
+    {
+        OutData.Append(Data.GetData(), RawSize);
+        return true;
+    }
 
-    // Serialize the decompressed data
-    Decompressor << OutData;
+    for (const TArray<uint8>& Chunk : Chunks)
+    {
+        int32 CompressedSize = Chunk.Num();
+        Writer << CompressedSize;
+    }
+    for (const TArray<uint8>& Chunk : Chunks)
+    {
+        OutData.Append(Chunk);
+    }
     return true;
 }
 
+bool USaveGLibrary::DecompressDataParallel(TConstArrayView<uint8> CompressedData, TArray<uint8>& OutData, int32 NumWorkers)
+{
+    uint32 Magic = 0;
+    if (CompressedData.Num() >= sizeof(uint32))
+    {
+        FMemory::Memcpy(&Magic, CompressedData.GetData(), sizeof(uint32));
+    }
+    if (Magic != SaveGSystemSpace::CompressedMagic)
+    {
+        // Files of older versions hold the whole payload as one Zlib stream. The proxy only reads from an array,
+        // so these are still copied once, also when the file is mapped
+        const TArray<uint8> LegacyData(CompressedData);
+        FArchiveLoadCompressedProxy Decompressor(LegacyData, NAME_Zlib);
+        if (Decompressor.IsError()) return false;
+
+        Decompressor << OutData;
+        return !Decompressor.IsError();
+    }
+
+    FMemoryReaderView Reader(CompressedData);
+    uint16 Version = 0;
+    uint8 CodecValue = static_cast<uint8>(ECompressionCodec_SaveGSystem::Zlib);
+    uint8 Flags = 0;
+    int32 ChunkSize = 0;
+    int32 RawSize = 0;
+    int32 NumChunks = 0;
+    Reader << Magic;
+    Reader << Version;
+    if (Version >= 2)
+    {
+        Reader << CodecValue;
+    }
+    if (Version >= 3)
+    {
+        Reader << Flags;
+    }
+    Reader << ChunkSize;
+    Reader << RawSize;
+    Reader << NumChunks;
+    if (CLOG_SAVE_G_SYSTEM(Reader.IsError() || Version == 0 || Version > SaveGSystemSpace::CompressedVersion, "Unsupported compressed data version: %i", Version)) return false;
+    if (CLOG_SAVE_G_SYSTEM(CodecValue > static_cast<uint8>(ECompressionCodec_SaveGSystem::OodleSelkie), "Unknown compression codec: %i", CodecValue)) return false;
+    if (Flags & SaveGSystemSpace::CompressedRawFlag)
+    {
+        if (CLOG_SAVE_G_SYSTEM(RawSize < 0 || NumChunks != 0 || CompressedData.Num() - Reader.Tell() != RawSize, "Compressed data is corrupted")) return false;
+
+        OutData.SetNumUninitialized(RawSize);
+        FMemory::Memcpy(OutData.GetData(), CompressedData.GetData() + Reader.Tell(), RawSize);
+        return true;
+    }
+    if (CLOG_SAVE_G_SYSTEM(ChunkSize <= 0 || RawSize < 0 || NumChunks != FMath::DivideAndRoundUp(RawSize, ChunkSize), "Compressed data is corrupted")) return false;
+    if (CLOG_SAVE_G_SYSTEM(NumChunks > (CompressedData.Num() - Reader.Tell()) / static_cast<int64>(sizeof(int32)), "Compressed data is corrupted")) return false;
+
+    // The chunk table gives every chunk its offset, so the chunks can be inflated independently
+    TArray<int64> Offsets;
+    TArray<int32> CompressedSizes;
+    Offsets.SetNumUninitialized(NumChunks);
+    CompressedSizes.SetNumUninitialized(NumChunks);
+    int64 Offset = Reader.Tell() + static_cast<int64>(NumChunks) * sizeof(int32);
+    for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+    {
+        Reader << CompressedSizes[ChunkIndex];
+        Offsets[ChunkIndex] = Offset;
+        Offset += CompressedSizes[ChunkIndex];
+        if (CLOG_SAVE_G_SYSTEM(CompressedSizes[ChunkIndex] <= 0 || Offset > CompressedData.Num(), "Compressed data is corrupted")) return false;
+    }
+
+    const ECompressionCodec_SaveGSystem Codec = static_cast<ECompressionCodec_SaveGSystem>(CodecValue);
+    OutData.SetNumUninitialized(RawSize);
+    std::atomic<bool> bFailed{false};
+    ParallelForChunks(NumChunks, NumWorkers,
+        [&](int32 ChunkIndex)
+        {
+            const int32 RawOffset = ChunkIndex * ChunkSize;
+            const int32 Size = FMath::Min(ChunkSize, RawSize - RawOffset);
+            if (!DecompressChunk(Codec, OutData.GetData() + RawOffset, Size, CompressedData.GetData() + Offsets[ChunkIndex], CompressedSizes[ChunkIndex]))
+            {
+                bFailed = true;
+            }
+        });
+    return !CLOG_SAVE_G_SYSTEM(bFailed, "Failed to decompress data");
+}
+
 FString USaveGLibrary::ConvertJsonObjectToString(const TSharedPtr<FJsonObject>& JsonObject)
 {
     FString OutputString;
@@ -66,7 +513,9 @@ FString USaveGLibrary::ConvertByteToString(const TArray<uint8>& ByteArray)
 {
     if (ByteArray.Num() > 0)
     {
-        return FString(UTF8_TO_TCHAR((const char*)(ByteArray.GetData())));
+        // The byte array is not null-terminated, so the length is passed explicitly
+        FUTF8ToTCHAR Converter((const ANSICHAR*)(ByteArray.GetData()), ByteArray.Num());
+        return FString(Converter.Length(), Converter.Get());
     }
     return {};
 }
@@ -78,8 +527,8 @@ TArray<FProperty*> USaveGLibrary::GetAllPropertyHasMetaSaveGame(const UObject* O
     {
         FProperty* Property = *PropIt;
         if (!Property) continue;
-        // Check if the property is marked with SaveGame metadata
-        if (Property->HasMetaData(TEXT("SaveGame")) || Property->HasAnyPropertyFlags(CPF_SaveGame))
+        // Check if the property is marked with the SaveGame flag, metadata is stripped in shipping builds
+        if (Property->HasAnyPropertyFlags(CPF_SaveGame))
         {
             Properties.Add(Property);
         }
@@ -102,6 +551,34 @@ TArray<FProperty*> USaveGLibrary::GetAllPropertyHasCustomMeta(const UObject* Obj
     return Properties;
 }
 
+EPropertyType_SaveGSystem USaveGLibrary::GetPropertyType(const FProperty* Property)
+{
+    if (!Property) return EPropertyType_SaveGSystem::None;
+    if (Property->IsA<FBoolProperty>()) return EPropertyType_SaveGSystem::Bool;
+    if (Property->IsA<FEnumProperty>()) return EPropertyType_SaveGSystem::Enum;
+    if (Property->IsA<FByteProperty>()) return EPropertyType_SaveGSystem::Byte;
+    if (Property->IsA<FInt8Property>()) return EPropertyType_SaveGSystem::Int8;
+    if (Property->IsA<FInt16Property>()) return EPropertyType_SaveGSystem::Int16;
+    if (Property->IsA<FUInt16Property>()) return EPropertyType_SaveGSystem::UInt16;
+    if (Property->IsA<FIntProperty>()) return EPropertyType_SaveGSystem::Int32;
+    if (Property->IsA<FUInt32Property>()) return EPropertyType_SaveGSystem::UInt32;
+    if (Property->IsA<FInt64Property>()) return EPropertyType_SaveGSystem::Int64;
+    if (Property->IsA<FUInt64Property>()) return EPropertyType_SaveGSystem::UInt64;
+    if (Property->IsA<FFloatProperty>()) return EPropertyType_SaveGSystem::Float;
+    if (Property->IsA<FDoubleProperty>()) return EPropertyType_SaveGSystem::Double;
+    if (Property->IsA<FStrProperty>()) return EPropertyType_SaveGSystem::Str;
+    if (Property->IsA<FNameProperty>()) return EPropertyType_SaveGSystem::Name;
+    if (Property->IsA<FTextProperty>()) return EPropertyType_SaveGSystem::Text;
+    // FSoftClassProperty is derived from FSoftObjectProperty, so it is checked first
+    if (Property->IsA<FSoftClassProperty>()) return EPropertyType_SaveGSystem::SoftClass;
+    if (Property->IsA<FSoftObjectProperty>()) return EPropertyType_SaveGSystem::SoftObject;
+    if (Property->IsA<FStructProperty>()) return EPropertyType_SaveGSystem::Struct;
+    if (Property->IsA<FArrayProperty>()) return EPropertyType_SaveGSystem::Array;
+    if (Property->IsA<FMapProperty>()) return EPropertyType_SaveGSystem::Map;
+    if (Property->IsA<FSetProperty>()) return EPropertyType_SaveGSystem::Set;
+    return EPropertyType_SaveGSystem::None;
+}
+
 bool USaveGLibrary::SerializeBoolProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
@@ -117,9 +594,9 @@ bool USaveGLibrary::DeserializeBoolProperty(FProperty* Property, void* ObjectDat
 {
     if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
     {
-        if (JsonObject->GetBoolField(Property->GetName()))
+        bool Value;
+        if (JsonObject->TryGetBoolField(Property->GetName(), Value))
         {
-            const bool Value = JsonObject->GetBoolField(Property->GetName());
             BoolProperty->SetPropertyValue_InContainer(ObjectData, Value);
             return true;
         }
@@ -127,6 +604,30 @@ bool USaveGLibrary::DeserializeBoolProperty(FProperty* Property, void* ObjectDat
     return false;
 }
 
+bool USaveGLibrary::SerializeBoolProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        Writer.WriteValue(Property->GetName(), BoolProperty->GetPropertyValue_InContainer(ObjectData));
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeBoolProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        if (Notation == EJsonNotation::Boolean)
+        {
+            BoolProperty->SetPropertyValue_InContainer(ObjectData, Reader.GetValueAsBoolean());
+            return true;
+        }
+        return SkipJsonValue(Reader, Notation);
+    }
+    return false;
+}
+
 bool USaveGLibrary::SerializeBoolProperty(FProperty* Property, const void* ObjectData, FString& Str)
 {
     if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
@@ -149,6 +650,30 @@ bool USaveGLibrary::DeserializeBoolProperty(FProperty* Property, void* ObjectDat
     return false;
 }
 
+bool USaveGLibrary::SerializeBoolProperty(FProperty* Property, const void* ObjectData, FArchive& Ar)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        // FArchive writes bool as uint32, a single byte is enough
+        uint8 Value = BoolProperty->GetPropertyValue_InContainer(ObjectData) ? 1 : 0;
+        Ar << Value;
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeBoolProperty(FProperty* Property, void* ObjectData, FArchive& Ar)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        uint8 Value = 0;
+        Ar << Value;
+        BoolProperty->SetPropertyValue_InContainer(ObjectData, Value != 0);
+        return true;
+    }
+    return false;
+}
+
 bool USaveGLibrary::SerializeByteProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
@@ -204,6 +729,50 @@ bool USaveGLibrary::DeserializeByteProperty(FProperty* Property, void* ObjectDat
     return false;
 }
 
+bool USaveGLibrary::SerializeByteProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        FNumericProperty* UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+        if (EnumProperty->GetEnum() && UnderlyingProperty)
+        {
+            const void* PropertyValuePtr = EnumProperty->ContainerPtrToValuePtr<void>(ObjectData);
+            Writer.WriteValue(Property->GetName(), UnderlyingProperty->GetSignedIntPropertyValue(PropertyValuePtr));
+            return true;
+        }
+    }
+    if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+    {
+        Writer.WriteValue(Property->GetName(), static_cast<int32>(ByteProperty->GetPropertyValue_InContainer(ObjectData)));
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeByteProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        FNumericProperty* UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+        if (UnderlyingProperty && Notation == EJsonNotation::Number)
+        {
+            UnderlyingProperty->SetIntPropertyValue(EnumProperty->ContainerPtrToValuePtr<void>(ObjectData), static_cast<int64>(Reader.GetValueAsNumber()));
+            return true;
+        }
+        return SkipJsonValue(Reader, Notation);
+    }
+    if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+    {
+        if (Notation == EJsonNotation::Number)
+        {
+            ByteProperty->SetPropertyValue_InContainer(ObjectData, static_cast<uint8>(static_cast<int32>(Reader.GetValueAsNumber())));
+            return true;
+        }
+        return SkipJsonValue(Reader, Notation);
+    }
+    return false;
+}
+
 bool USaveGLibrary::SerializeByteProperty(FProperty* Property, const void* ObjectData, FString& Str)
 {
     if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
@@ -256,15 +825,61 @@ bool USaveGLibrary::DeserializeByteProperty(FProperty* Property, void* ObjectDat
     return false;
 }
 
-bool USaveGLibrary::SerializeStringProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
+bool USaveGLibrary::SerializeByteProperty(FProperty* Property, const void* ObjectData, FArchive& Ar)
 {
-    if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
-    {
-        const FString Value = StrProperty->GetPropertyValue_InContainer(ObjectData);
-        JsonObject->SetStringField(Property->GetName(), Value);
-        return true;
-    }
-    if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        FNumericProperty* UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+        if (EnumProperty->GetEnum() && UnderlyingProperty)
+        {
+            const void* PropertyValuePtr = EnumProperty->ContainerPtrToValuePtr<void>(ObjectData);
+            int64 EnumValue = UnderlyingProperty->GetSignedIntPropertyValue(PropertyValuePtr);
+            Ar << EnumValue;
+            return true;
+        }
+    }
+    if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+    {
+        uint8 Value = ByteProperty->GetPropertyValue_InContainer(ObjectData);
+        Ar << Value;
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeByteProperty(FProperty* Property, void* ObjectData, FArchive& Ar)
+{
+    if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        FNumericProperty* UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+        if (EnumProperty->GetEnum() && UnderlyingProperty)
+        {
+            int64 EnumValue = 0;
+            Ar << EnumValue;
+            void* PropertyValuePtr = EnumProperty->ContainerPtrToValuePtr<void>(ObjectData);
+            UnderlyingProperty->SetIntPropertyValue(PropertyValuePtr, EnumValue);
+            return true;
+        }
+    }
+    else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+    {
+        uint8 Value = 0;
+        Ar << Value;
+        ByteProperty->SetPropertyValue_InContainer(ObjectData, Value);
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeStringProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
+{
+    if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        const FString Value = StrProperty->GetPropertyValue_InContainer(ObjectData);
+        JsonObject->SetStringField(Property->GetName(), Value);
+        return true;
+    }
+    if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
     {
         const FName Value = NameProperty->GetPropertyValue_InContainer(ObjectData);
         JsonObject->SetStringField(Property->GetName(), Value.ToString());
@@ -311,6 +926,47 @@ bool USaveGLibrary::DeserializeStringProperty(FProperty* Property, void* ObjectD
     return false;
 }
 
+bool USaveGLibrary::SerializeStringProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        Writer.WriteValue(Property->GetName(), StrProperty->GetPropertyValue_InContainer(ObjectData));
+        return true;
+    }
+    if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    {
+        Writer.WriteValue(Property->GetName(), NameProperty->GetPropertyValue_InContainer(ObjectData).ToString());
+        return true;
+    }
+    if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+    {
+        Writer.WriteValue(Property->GetName(), TextProperty->GetPropertyValue_InContainer(ObjectData).ToString());
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeStringProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (!Property->IsA<FStrProperty>() && !Property->IsA<FNameProperty>() && !Property->IsA<FTextProperty>()) return false;
+    if (Notation != EJsonNotation::String) return SkipJsonValue(Reader, Notation);
+
+    const FString& Value = Reader.GetValueAsString();
+    if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        StrProperty->SetPropertyValue_InContainer(ObjectData, Value);
+    }
+    else if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    {
+        NameProperty->SetPropertyValue_InContainer(ObjectData, FName(*Value));
+    }
+    else if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+    {
+        TextProperty->SetPropertyValue_InContainer(ObjectData, FText::FromString(Value));
+    }
+    return true;
+}
+
 bool USaveGLibrary::SerializeStringProperty(FProperty* Property, const void* ObjectData, FString& Str)
 {
     if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
@@ -354,6 +1010,55 @@ bool USaveGLibrary::DeserializeStringProperty(FProperty* Property, void* ObjectD
     return false;
 }
 
+bool USaveGLibrary::SerializeStringProperty(FProperty* Property, const void* ObjectData, FArchive& Ar)
+{
+    if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        FString Value = StrProperty->GetPropertyValue_InContainer(ObjectData);
+        Ar << Value;
+        return true;
+    }
+    if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    {
+        FName Value = NameProperty->GetPropertyValue_InContainer(ObjectData);
+        Ar << Value;
+        return true;
+    }
+    if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+    {
+        FString Value = TextProperty->GetPropertyValue_InContainer(ObjectData).ToString();
+        Ar << Value;
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeStringProperty(FProperty* Property, void* ObjectData, FArchive& Ar)
+{
+    if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        FString Value;
+        Ar << Value;
+        StrProperty->SetPropertyValue_InContainer(ObjectData, Value);
+        return true;
+    }
+    if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    {
+        FName Value;
+        Ar << Value;
+        NameProperty->SetPropertyValue_InContainer(ObjectData, Value);
+        return true;
+    }
+    if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+    {
+        FString Value;
+        Ar << Value;
+        TextProperty->SetPropertyValue_InContainer(ObjectData, FText::FromString(Value));
+        return true;
+    }
+    return false;
+}
+
 bool USaveGLibrary::SerializeNumericProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (const FInt8Property* Int8Property = CastField<FInt8Property>(Property))
@@ -499,6 +1204,51 @@ bool USaveGLibrary::DeserializeNumericProperty(FProperty* Property, void* Object
     return false;
 }
 
+bool USaveGLibrary::SerializeNumericProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+    if (!NumericProperty) return false;
+
+    // Same number representation as the JSON object path, so both outputs load the same way
+    const void* PropertyValuePtr = NumericProperty->ContainerPtrToValuePtr<void>(ObjectData);
+    if (NumericProperty->IsFloatingPoint())
+    {
+        Writer.WriteValue(Property->GetName(), NumericProperty->GetFloatingPointPropertyValue(PropertyValuePtr));
+    }
+    else if (NumericProperty->IsA<FUInt64Property>())
+    {
+        Writer.WriteValue(Property->GetName(), static_cast<double>(NumericProperty->GetUnsignedIntPropertyValue(PropertyValuePtr)));
+    }
+    else
+    {
+        Writer.WriteValue(Property->GetName(), NumericProperty->GetSignedIntPropertyValue(PropertyValuePtr));
+    }
+    return true;
+}
+
+bool USaveGLibrary::DeserializeNumericProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+    if (!NumericProperty) return false;
+    if (Notation != EJsonNotation::Number) return SkipJsonValue(Reader, Notation);
+
+    void* PropertyValuePtr = NumericProperty->ContainerPtrToValuePtr<void>(ObjectData);
+    const double Value = Reader.GetValueAsNumber();
+    if (NumericProperty->IsFloatingPoint())
+    {
+        NumericProperty->SetFloatingPointPropertyValue(PropertyValuePtr, Value);
+    }
+    else if (NumericProperty->IsA<FUInt64Property>())
+    {
+        NumericProperty->SetIntPropertyValue(PropertyValuePtr, static_cast<uint64>(Value));
+    }
+    else
+    {
+        NumericProperty->SetIntPropertyValue(PropertyValuePtr, static_cast<int64>(Value));
+    }
+    return true;
+}
+
 bool USaveGLibrary::SerializeNumericProperty(FProperty* Property, const void* ObjectData, FString& Str)
 {
     if (const FInt8Property* Int8Property = CastField<FInt8Property>(Property))
@@ -617,13 +1367,41 @@ bool USaveGLibrary::DeserializeNumericProperty(FProperty* Property, void* Object
     return false;
 }
 
+bool USaveGLibrary::SerializeNumericProperty(FProperty* Property, const void* ObjectData, FArchive& Ar)
+{
+    if (SerializeNumericValue<FInt8Property>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FInt16Property>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FUInt16Property>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FIntProperty>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FUInt32Property>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FInt64Property>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FUInt64Property>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FFloatProperty>(Property, ObjectData, Ar)) return true;
+    if (SerializeNumericValue<FDoubleProperty>(Property, ObjectData, Ar)) return true;
+    return false;
+}
+
+bool USaveGLibrary::DeserializeNumericProperty(FProperty* Property, void* ObjectData, FArchive& Ar)
+{
+    if (DeserializeNumericValue<FInt8Property>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FInt16Property>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FUInt16Property>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FIntProperty>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FUInt32Property>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FInt64Property>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FUInt64Property>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FFloatProperty>(Property, ObjectData, Ar)) return true;
+    if (DeserializeNumericValue<FDoubleProperty>(Property, ObjectData, Ar)) return true;
+    return false;
+}
+
 bool USaveGLibrary::SerializeObjectProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (FSoftClassProperty* SoftClassProperty = CastField<FSoftClassProperty>(Property))
     {
         FSoftObjectPtr SoftClass = SoftClassProperty->GetPropertyValue_InContainer(ObjectData);
 
-        if (SoftClass.IsValid())
+        if (!SoftClass.IsNull())
         {
             // Serialize the class's asset path
             FString ClassPath = SoftClass.ToString();
@@ -632,7 +1410,7 @@ bool USaveGLibrary::SerializeObjectProperty(FProperty* Property, const void* Obj
         }
         else
         {
-            // If the class reference is invalid, serialize it as null
+            // If the class reference is empty, serialize it as null
             JsonObject->SetField(Property->GetName(), MakeShared<FJsonValueNull>());
             return true;
         }
@@ -641,7 +1419,7 @@ bool USaveGLibrary::SerializeObjectProperty(FProperty* Property, const void* Obj
     {
         FSoftObjectPtr SoftObject = SoftObjectProperty->GetPropertyValue_InContainer(ObjectData);
 
-        if (SoftObject.IsValid())
+        if (!SoftObject.IsNull())
         {
             // Serialize the object's asset path
             const FString AssetPath = SoftObject.ToString();
@@ -650,7 +1428,7 @@ bool USaveGLibrary::SerializeObjectProperty(FProperty* Property, const void* Obj
         }
         else
         {
-            // If the object reference is invalid, serialize it as null
+            // If the object reference is empty, serialize it as null
             JsonObject->SetField(Property->GetName(), MakeShared<FJsonValueNull>());
             return true;
         }
@@ -697,6 +1475,68 @@ bool USaveGLibrary::DeserializeObjectProperty(FProperty* Property, void* ObjectD
     return false;
 }
 
+bool USaveGLibrary::SerializeObjectProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+    {
+        // Soft class properties derive from soft object properties and are written the same way
+        // Null-ness comes from the stored path: resolving the object is not safe off the game thread,
+        // and a reference to an asset that is not loaded must still keep its path
+        const FSoftObjectPtr SoftObject = SoftObjectProperty->GetPropertyValue_InContainer(ObjectData);
+        if (!SoftObject.IsNull())
+        {
+            Writer.WriteValue(Property->GetName(), SoftObject.ToString());
+        }
+        else
+        {
+            Writer.WriteNull(Property->GetName());
+        }
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeObjectProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+    {
+        // Soft class properties derive from soft object properties and are read the same way
+        if (Notation == EJsonNotation::String)
+        {
+            SoftObjectProperty->SetPropertyValue_InContainer(ObjectData, FSoftObjectPtr(FSoftObjectPath(Reader.GetValueAsString())));
+            return true;
+        }
+        SoftObjectProperty->SetPropertyValue_InContainer(ObjectData, FSoftObjectPtr());
+        return SkipJsonValue(Reader, Notation);
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeObjectProperty(FProperty* Property, const void* ObjectData, FArchive& Ar)
+{
+    // FSoftClassProperty is derived from FSoftObjectProperty and shares the same value type
+    if (FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+    {
+        // The asset path is written even if the asset is not loaded, an empty path means null
+        FString AssetPath = SoftObjectProperty->GetPropertyValue_InContainer(ObjectData).ToString();
+        Ar << AssetPath;
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeObjectProperty(FProperty* Property, void* ObjectData, FArchive& Ar)
+{
+    if (FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+    {
+        FString AssetPath;
+        Ar << AssetPath;
+        SoftObjectProperty->SetPropertyValue_InContainer(ObjectData, AssetPath.IsEmpty() ? FSoftObjectPtr() : FSoftObjectPtr(FSoftObjectPath(AssetPath)));
+        return true;
+    }
+    return false;
+}
+
 bool USaveGLibrary::SerializeStructProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (!Property || !ObjectData || !JsonObject.IsValid()) return false;
@@ -714,13 +1554,11 @@ bool USaveGLibrary::SerializeStructProperty(FProperty* Property, const void* Obj
         void const* StructData = StructProperty->ContainerPtrToValuePtr<void>(ObjectData);
         if (!StructData) return false;
 
-        // Iterate over the struct fields
-        for (TFieldIterator<FProperty> It(Struct); It; ++It)
+        // Iterate over the cached plan of the struct fields
+        const FSaveGPropertyPlanRef Plan = FSaveGPropertyPlan::Get(Struct);
+        for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan->GetEntries())
         {
-            FProperty* StructField = *It;
-            if (!StructField) continue;
-
-            SerializeSubProperty(StructField, StructData, StructJsonObject);
+            SerializeSubProperty(Entry.Property, StructData, StructJsonObject);
         }
 
         JsonObject->SetObjectField(Property->GetName(), StructJsonObject);
@@ -744,12 +1582,10 @@ bool USaveGLibrary::DeserializeStructProperty(FProperty* Property, void* ObjectD
             void* StructData = StructProperty->ContainerPtrToValuePtr<void>(ObjectData);
             if (!StructData) return false;
 
-            for (TFieldIterator<FProperty> It(Struct); It; ++It)
+            const FSaveGPropertyPlanRef Plan = FSaveGPropertyPlan::Get(Struct);
+            for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan->GetEntries())
             {
-                FProperty* StructField = *It;
-                if (!StructField) continue;
-
-                DeserializeSubProperty(StructField, StructData, *StructJson);
+                DeserializeSubProperty(Entry.Property, StructData, *StructJson);
             }
             return true;
         }
@@ -758,6 +1594,64 @@ bool USaveGLibrary::DeserializeStructProperty(FProperty* Property, void* ObjectD
     return false;
 }
 
+bool USaveGLibrary::SerializeStructProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (!Property || !ObjectData) return false;
+
+    if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        if (!StructProperty->Struct) return false;
+
+        const void* StructData = StructProperty->ContainerPtrToValuePtr<void>(ObjectData);
+        Writer.WriteObjectStart(Property->GetName());
+        for (const FPropertyPlanEntry_SaveGSystem& Entry : FSaveGPropertyPlan::Get(StructProperty->Struct)->GetEntries())
+        {
+            SerializeSubProperty(Entry.Property, StructData, Writer);
+        }
+        Writer.WriteObjectEnd();
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeStructProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        if (!StructProperty->Struct || Notation != EJsonNotation::ObjectStart) return SkipJsonValue(Reader, Notation);
+
+        DeserializePropertyBlock(*FSaveGPropertyPlan::Get(StructProperty->Struct), StructProperty->ContainerPtrToValuePtr<void>(ObjectData), Reader);
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeStructProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        if (!StructProperty->Struct) return false;
+
+        const void* StructData = StructProperty->ContainerPtrToValuePtr<void>(ObjectData);
+        SerializePropertyBlock(*FSaveGPropertyPlan::Get(StructProperty->Struct), StructData, Ar, bSkipDefaults);
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeStructProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        if (!StructProperty->Struct) return false;
+
+        void* StructData = StructProperty->ContainerPtrToValuePtr<void>(ObjectData);
+        DeserializePropertyBlock(*FSaveGPropertyPlan::Get(StructProperty->Struct), StructData, Ar, bSkipDefaults);
+        return !Ar.IsError();
+    }
+    return false;
+}
+
 bool USaveGLibrary::SerializeArrayProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
@@ -768,12 +1662,32 @@ bool USaveGLibrary::SerializeArrayProperty(FProperty* Property, const void* Obje
         // Get the array pointer
         FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(ObjectData));
 
+        // Plain structs go as one base64 block of their memory, validated on load by the element size and layout hash
+        if (InnerProperty->IsA<FStructProperty>() && FSaveGPropertyPlan::IsBulkCopyable(InnerProperty))
+        {
+            const int32 ElementSize = InnerProperty->GetSize();
+            TSharedPtr<FJsonObject> PackedObject = MakeShared<FJsonObject>();
+            PackedObject->SetNumberField(TEXT("ElementSize"), ElementSize);
+            PackedObject->SetNumberField(TEXT("Layout"), FSaveGPropertyPlan::GetLayoutHash(InnerProperty));
+            PackedObject->SetStringField(TEXT("Data"), ArrayHelper.Num() > 0 ? FBase64::Encode(ArrayHelper.GetRawPtr(0), ArrayHelper.Num() * ElementSize) : FString());
+            JsonObject->SetObjectField(Property->GetName(), PackedObject);
+            return true;
+        }
+
         TArray<TSharedPtr<FJsonValue>> JsonArray;
+        JsonArray.Reserve(ArrayHelper.Num());
+        const bool bScalar = IsScalarJsonProperty(InnerProperty);
         for (int32 Index = 0; Index < ArrayHelper.Num(); Index++)
         {
             const void* ElementPtr = ArrayHelper.GetRawPtr(Index);
             if (!ElementPtr) continue;
 
+            if (bScalar)
+            {
+                JsonArray.Add(MakeScalarJsonValue(InnerProperty, ElementPtr));
+                continue;
+            }
+
             TSharedPtr<FJsonObject> JsonObjectValue = MakeShared<FJsonObject>();
             SerializeSubProperty(InnerProperty, ElementPtr, JsonObjectValue);
             if (JsonObjectValue.IsValid())
@@ -792,6 +1706,32 @@ bool USaveGLibrary::DeserializeArrayProperty(FProperty* Property, void* ObjectDa
 {
     if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
     {
+        const TSharedPtr<FJsonObject>* PackedObject;
+        if (JsonObject->TryGetObjectField(Property->GetName(), PackedObject))
+        {
+            // A changed struct layout can't be copied back, the field keeps its current value
+            const int32 ElementSize = ArrayProperty->Inner->GetSize();
+            int32 SavedElementSize = 0;
+            uint32 SavedLayout = 0;
+            if (!FSaveGPropertyPlan::IsBulkCopyable(ArrayProperty->Inner)) return false;
+            if (!(*PackedObject)->TryGetNumberField(TEXT("ElementSize"), SavedElementSize) || SavedElementSize != ElementSize) return false;
+            if (!(*PackedObject)->TryGetNumberField(TEXT("Layout"), SavedLayout) || SavedLayout != FSaveGPropertyPlan::GetLayoutHash(ArrayProperty->Inner)) return false;
+
+            FString Data;
+            TArray<uint8> RawData;
+            if (!(*PackedObject)->TryGetStringField(TEXT("Data"), Data)) return false;
+            if (!Data.IsEmpty() && !FBase64::Decode(Data, RawData)) return false;
+            if (RawData.Num() % ElementSize != 0) return false;
+
+            FScriptArrayHelper Helper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(ObjectData));
+            Helper.Resize(RawData.Num() / ElementSize);
+            if (RawData.Num() > 0)
+            {
+                FMemory::Memcpy(Helper.GetRawPtr(0), RawData.GetData(), RawData.Num());
+            }
+            return true;
+        }
+
         const TArray<TSharedPtr<FJsonValue>>* JsonArray;
         if (JsonObject->TryGetArrayField(Property->GetName(), JsonArray))
         {
@@ -802,6 +1742,12 @@ bool USaveGLibrary::DeserializeArrayProperty(FProperty* Property, void* ObjectDa
             {
                 const TSharedPtr<FJsonValue>& JsonValue = (*JsonArray)[i];
                 void* ElementPtr = Helper.GetRawPtr(i);
+                if (JsonValue.IsValid() && JsonValue->Type != EJson::Object)
+                {
+                    SetScalarJsonValue(ArrayProperty->Inner, ElementPtr, JsonValue);
+                    continue;
+                }
+
                 TSharedPtr<FJsonObject>* JsonObjectValue;
                 if (JsonValue->TryGetObject(JsonObjectValue))
                 {
@@ -814,27 +1760,250 @@ bool USaveGLibrary::DeserializeArrayProperty(FProperty* Property, void* ObjectDa
     return false;
 }
 
-FString USaveGLibrary::SerializeMapKeyValue(FProperty* Property, const void* Ptr)
+bool USaveGLibrary::SerializeArrayProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
 {
-    FString Result;
-    if (SerializeBoolProperty(Property, Ptr, Result)) return Result;
-    if (SerializeByteProperty(Property, Ptr, Result)) return Result;
-    if (SerializeStringProperty(Property, Ptr, Result)) return Result;
-    if (SerializeNumericProperty(Property, Ptr, Result)) return Result;
+    if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+    {
+        FProperty* InnerProperty = ArrayProperty->Inner;
+        FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(ObjectData));
 
-    return Result;
-}
+        // Same layout as the JSON object path: a packed block for plain structs, plain values for scalars
+        if (InnerProperty->IsA<FStructProperty>() && FSaveGPropertyPlan::IsBulkCopyable(InnerProperty))
+        {
+            const int32 ElementSize = InnerProperty->GetSize();
+            Writer.WriteObjectStart(Property->GetName());
+            Writer.WriteValue(TEXT("ElementSize"), ElementSize);
+            Writer.WriteValue(TEXT("Layout"), static_cast<int64>(FSaveGPropertyPlan::GetLayoutHash(InnerProperty)));
+            Writer.WriteValue(TEXT("Data"), ArrayHelper.Num() > 0 ? FBase64::Encode(ArrayHelper.GetRawPtr(0), ArrayHelper.Num() * ElementSize) : FString());
+            Writer.WriteObjectEnd();
+            return true;
+        }
 
-bool USaveGLibrary::DeserializeMapKeyValue(FProperty* Property, void* Ptr, const FString& DataString)
-{
-    if (DeserializeBoolProperty(Property, Ptr, DataString)) return true;
-    if (DeserializeByteProperty(Property, Ptr, DataString)) return true;
-    if (DeserializeStringProperty(Property, Ptr, DataString)) return true;
-    if (DeserializeNumericProperty(Property, Ptr, DataString)) return true;
+        const bool bScalar = IsScalarJsonProperty(InnerProperty);
+        Writer.WriteArrayStart(Property->GetName());
+        for (int32 Index = 0; Index < ArrayHelper.Num(); Index++)
+        {
+            const void* ElementPtr = ArrayHelper.GetRawPtr(Index);
+            if (bScalar)
+            {
+                WriteScalarJsonValue(Writer, InnerProperty, ElementPtr);
+                continue;
+            }
 
+            Writer.WriteObjectStart();
+            SerializeSubProperty(InnerProperty, ElementPtr, Writer);
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteArrayEnd();
+        return true;
+    }
     return false;
 }
 
+bool USaveGLibrary::DeserializeArrayProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+    {
+        FProperty* InnerProperty = ArrayProperty->Inner;
+        FScriptArrayHelper Helper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(ObjectData));
+
+        // Packed block of plain structs, its fields may come in any order
+        if (Notation == EJsonNotation::ObjectStart)
+        {
+            int32 ElementSize = 0;
+            uint32 Layout = 0;
+            FString Data;
+            while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString& Identifier = Reader.GetIdentifier();
+                if (Notation == EJsonNotation::Number && Identifier == TEXT("ElementSize")) ElementSize = static_cast<int32>(Reader.GetValueAsNumber());
+                else if (Notation == EJsonNotation::Number && Identifier == TEXT("Layout")) Layout = static_cast<uint32>(Reader.GetValueAsNumber());
+                else if (Notation == EJsonNotation::String && Identifier == TEXT("Data")) Data = Reader.GetValueAsString();
+                else SkipJsonValue(Reader, Notation);
+            }
+
+            // A changed struct layout can't be copied back, the field keeps its current value
+            TArray<uint8> RawData;
+            if (!FSaveGPropertyPlan::IsBulkCopyable(InnerProperty) || ElementSize != InnerProperty->GetSize()) return true;
+            if (Layout != FSaveGPropertyPlan::GetLayoutHash(InnerProperty)) return true;
+            if (!Data.IsEmpty() && !FBase64::Decode(Data, RawData)) return true;
+            if (RawData.Num() % ElementSize != 0) return true;
+
+            Helper.Resize(RawData.Num() / ElementSize);
+            if (RawData.Num() > 0)
+            {
+                FMemory::Memcpy(Helper.GetRawPtr(0), RawData.GetData(), RawData.Num());
+            }
+            return true;
+        }
+        if (Notation != EJsonNotation::ArrayStart) return SkipJsonValue(Reader, Notation);
+
+        // Elements are either plain values or objects wrapping the value under the inner property name
+        Helper.EmptyValues();
+        const FString InnerName = InnerProperty->GetName();
+        while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ArrayEnd)
+        {
+            void* ElementPtr = Helper.GetRawPtr(Helper.AddValue());
+            if (Notation != EJsonNotation::ObjectStart)
+            {
+                if (!ReadScalarJsonValue(InnerProperty, ElementPtr, Reader, Notation))
+                {
+                    SkipJsonValue(Reader, Notation);
+                }
+                continue;
+            }
+            while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                if (Reader.GetIdentifier() == InnerName)
+                {
+                    DeserializeSubProperty(InnerProperty, ElementPtr, Reader, Notation);
+                }
+                else
+                {
+                    SkipJsonValue(Reader, Notation);
+                }
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeArrayProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+    {
+        FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(ObjectData));
+
+        // The element type is written once, the elements themselves are not tagged
+        const EPropertyType_SaveGSystem InnerPropertyType = GetPropertyType(ArrayProperty->Inner);
+        uint8 InnerType = static_cast<uint8>(InnerPropertyType);
+        int32 Num = ArrayHelper.Num();
+
+        // Plain elements are written as one memory block, guarded by the element size and layout hash
+        if (FSaveGPropertyPlan::IsBulkCopyable(ArrayProperty->Inner))
+        {
+            InnerType |= SaveGSystemSpace::PackedArrayFlag;
+            int32 ElementSize = ArrayProperty->Inner->GetSize();
+            uint32 LayoutHash = FSaveGPropertyPlan::GetLayoutHash(ArrayProperty->Inner);
+            Ar << InnerType;
+            Ar << Num;
+            Ar << ElementSize;
+            Ar << LayoutHash;
+            if (Num > 0)
+            {
+                Ar.Serialize(ArrayHelper.GetRawPtr(0), static_cast<int64>(Num) * ElementSize);
+            }
+            return true;
+        }
+
+        // Other structs are split into columns, so that values of the same field and type are stored next to each other
+        const FStructProperty* InnerStructProperty = CastField<FStructProperty>(ArrayProperty->Inner);
+        if (InnerStructProperty && InnerStructProperty->Struct)
+        {
+            InnerType |= SaveGSystemSpace::ColumnarArrayFlag;
+            Ar << InnerType;
+            Ar << Num;
+            SerializeStructColumns(*FSaveGPropertyPlan::Get(InnerStructProperty->Struct), ArrayHelper, Ar, bSkipDefaults);
+            return true;
+        }
+
+        Ar << InnerType;
+        Ar << Num;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            SerializePropertyValue(ArrayProperty->Inner, InnerPropertyType, ArrayHelper.GetRawPtr(Index), Ar, bSkipDefaults);
+        }
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeArrayProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+    {
+        uint8 InnerType = 0;
+        int32 Num = 0;
+        Ar << InnerType;
+        Ar << Num;
+        const EPropertyType_SaveGSystem InnerPropertyType = GetPropertyType(ArrayProperty->Inner);
+        const bool bPacked = (InnerType & SaveGSystemSpace::PackedArrayFlag) != 0;
+        const bool bColumnar = (InnerType & SaveGSystemSpace::ColumnarArrayFlag) != 0;
+        InnerType &= ~(SaveGSystemSpace::PackedArrayFlag | SaveGSystemSpace::ColumnarArrayFlag);
+        if (InnerType != static_cast<uint8>(InnerPropertyType)) return false;
+        if (!IsValidContainerNum(Ar, Num)) return false;
+
+        FScriptArrayHelper Helper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(ObjectData));
+        if (bColumnar)
+        {
+            const FStructProperty* InnerStructProperty = CastField<FStructProperty>(ArrayProperty->Inner);
+            if (!InnerStructProperty || !InnerStructProperty->Struct) return false;
+
+            Helper.Resize(Num);
+            DeserializeStructColumns(*FSaveGPropertyPlan::Get(InnerStructProperty->Struct), Helper, Ar, bSkipDefaults);
+            return !Ar.IsError();
+        }
+        if (bPacked)
+        {
+            int32 ElementSize = 0;
+            uint32 LayoutHash = 0;
+            Ar << ElementSize;
+            Ar << LayoutHash;
+
+            // A changed struct layout can't be copied back, the caller skips the whole entry
+            if (!FSaveGPropertyPlan::IsBulkCopyable(ArrayProperty->Inner) || ElementSize != ArrayProperty->Inner->GetSize()
+                || LayoutHash != FSaveGPropertyPlan::GetLayoutHash(ArrayProperty->Inner))
+            {
+                return false;
+            }
+            const int64 DataSize = static_cast<int64>(Num) * ElementSize;
+            if (DataSize > Ar.TotalSize() - Ar.Tell())
+            {
+                Ar.SetError();
+                return false;
+            }
+            Helper.Resize(Num);
+            if (Num > 0)
+            {
+                Ar.Serialize(Helper.GetRawPtr(0), DataSize);
+            }
+            return !Ar.IsError();
+        }
+
+        Helper.Resize(Num);
+        for (int32 Index = 0; Index < Num && !Ar.IsError(); ++Index)
+        {
+            DeserializePropertyValue(ArrayProperty->Inner, InnerPropertyType, Helper.GetRawPtr(Index), Ar, bSkipDefaults);
+        }
+        return !Ar.IsError();
+    }
+    return false;
+}
+
+FString USaveGLibrary::SerializeMapKeyValue(FProperty* Property, const void* Ptr)
+{
+    FString Result;
+    if (SerializeBoolProperty(Property, Ptr, Result)) return Result;
+    if (SerializeByteProperty(Property, Ptr, Result)) return Result;
+    if (SerializeStringProperty(Property, Ptr, Result)) return Result;
+    if (SerializeNumericProperty(Property, Ptr, Result)) return Result;
+
+    // Struct, object and other keys have no plain string form
+    Property->ExportTextItem_InContainer(Result, Ptr, nullptr, nullptr, PPF_None);
+    return Result;
+}
+
+bool USaveGLibrary::DeserializeMapKeyValue(FProperty* Property, void* Ptr, const FString& DataString)
+{
+    if (DeserializeBoolProperty(Property, Ptr, DataString)) return true;
+    if (DeserializeByteProperty(Property, Ptr, DataString)) return true;
+    if (DeserializeStringProperty(Property, Ptr, DataString)) return true;
+    if (DeserializeNumericProperty(Property, Ptr, DataString)) return true;
+
+    return Property->ImportText_InContainer(*DataString, Ptr, nullptr, PPF_None) != nullptr;
+}
+
 bool USaveGLibrary::SerializeMapProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
@@ -939,6 +2108,371 @@ bool USaveGLibrary::DeserializeMapProperty(FProperty* Property, void* ObjectData
     return false;
 }
 
+bool USaveGLibrary::SerializeMapProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+    {
+        FScriptMapHelper MapHelper(MapProperty, MapProperty->ContainerPtrToValuePtr<void>(ObjectData));
+
+        // Every value is wrapped into an object under its string key, as in the JSON object path
+        Writer.WriteObjectStart(Property->GetName());
+        for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+        {
+            if (!MapHelper.IsValidIndex(Index)) continue;
+
+            const void* PairPtr = MapHelper.GetPairPtr(Index);
+            Writer.WriteObjectStart(SerializeMapKeyValue(MapProperty->KeyProp, PairPtr));
+            SerializeSubProperty(MapProperty->ValueProp, PairPtr, Writer);
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteObjectEnd();
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeMapProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+    {
+        if (Notation != EJsonNotation::ObjectStart) return SkipJsonValue(Reader, Notation);
+
+        FProperty* KeyProperty = MapProperty->KeyProp;
+        FProperty* ValueProperty = MapProperty->ValueProp;
+        FScriptMapHelper MapHelper(MapProperty, MapProperty->ContainerPtrToValuePtr<void>(ObjectData));
+        MapHelper.EmptyValues();
+
+        // Keys are the field names, values are objects wrapping the value under the value property name
+        const FString ValueName = ValueProperty->GetName();
+        while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+        {
+            const int32 MapIndex = MapHelper.AddDefaultValue_Invalid_NeedsRehash();
+            void* PairPtr = MapHelper.GetPairPtr(MapIndex);
+            if (Notation != EJsonNotation::ObjectStart || !DeserializeMapKeyValue(KeyProperty, PairPtr, Reader.GetIdentifier()))
+            {
+                MapHelper.RemoveAt(MapIndex);
+                SkipJsonValue(Reader, Notation);
+                continue;
+            }
+            while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                if (Reader.GetIdentifier() == ValueName)
+                {
+                    DeserializeSubProperty(ValueProperty, PairPtr, Reader, Notation);
+                }
+                else
+                {
+                    SkipJsonValue(Reader, Notation);
+                }
+            }
+        }
+
+        // Rehash the map once after adding all elements
+        MapHelper.Rehash();
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeMapProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+    {
+        FScriptMapHelper MapHelper(MapProperty, MapProperty->ContainerPtrToValuePtr<void>(ObjectData));
+
+        // Keys and values are written as two typed columns, so struct and object keys survive the round-trip
+        const EPropertyType_SaveGSystem KeyPropertyType = GetPropertyType(MapProperty->KeyProp);
+        const EPropertyType_SaveGSystem ValuePropertyType = GetPropertyType(MapProperty->ValueProp);
+        const bool bKeyPacked = FSaveGPropertyPlan::IsBulkCopyable(MapProperty->KeyProp);
+        const bool bValuePacked = FSaveGPropertyPlan::IsBulkCopyable(MapProperty->ValueProp);
+        uint8 KeyType = static_cast<uint8>(KeyPropertyType) | SaveGSystemSpace::ColumnarArrayFlag | (bKeyPacked ? SaveGSystemSpace::PackedArrayFlag : 0);
+        uint8 ValueType = static_cast<uint8>(ValuePropertyType) | (bValuePacked ? SaveGSystemSpace::PackedArrayFlag : 0);
+        int32 Num = MapHelper.Num();
+        Ar << KeyType;
+        Ar << ValueType;
+        Ar << Num;
+
+        TArray<uint8*> Pairs;
+        Pairs.Reserve(Num);
+        for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+        {
+            if (MapHelper.IsValidIndex(Index))
+            {
+                Pairs.Add(MapHelper.GetPairPtr(Index));
+            }
+        }
+        SerializeValueColumn(MapProperty->KeyProp, KeyPropertyType, bKeyPacked, Num, [&Pairs](int32 Index) { return Pairs[Index]; }, Ar, bSkipDefaults);
+        SerializeValueColumn(MapProperty->ValueProp, ValuePropertyType, bValuePacked, Num, [&Pairs](int32 Index) { return Pairs[Index]; }, Ar, bSkipDefaults);
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeMapProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+    {
+        uint8 KeyType = 0;
+        uint8 ValueType = 0;
+        int32 Num = 0;
+        Ar << KeyType;
+        Ar << ValueType;
+        Ar << Num;
+        const bool bColumnar = (KeyType & SaveGSystemSpace::ColumnarArrayFlag) != 0;
+        const bool bKeyPacked = (KeyType & SaveGSystemSpace::PackedArrayFlag) != 0;
+        const bool bValuePacked = (ValueType & SaveGSystemSpace::PackedArrayFlag) != 0;
+        KeyType &= ~(SaveGSystemSpace::PackedArrayFlag | SaveGSystemSpace::ColumnarArrayFlag);
+        ValueType &= ~SaveGSystemSpace::PackedArrayFlag;
+        const EPropertyType_SaveGSystem KeyPropertyType = GetPropertyType(MapProperty->KeyProp);
+        const EPropertyType_SaveGSystem ValuePropertyType = GetPropertyType(MapProperty->ValueProp);
+        if (KeyType != static_cast<uint8>(KeyPropertyType)) return false;
+        if (ValueType != static_cast<uint8>(ValuePropertyType)) return false;
+        if (!IsValidContainerNum(Ar, Num)) return false;
+
+        FScriptMapHelper MapHelper(MapProperty, MapProperty->ContainerPtrToValuePtr<void>(ObjectData));
+        MapHelper.EmptyValues(Num);
+
+        // Streams before version 5 interleave keys and values
+        if (!bColumnar)
+        {
+            for (int32 Index = 0; Index < Num && !Ar.IsError(); ++Index)
+            {
+                const int32 MapIndex = MapHelper.AddDefaultValue_Invalid_NeedsRehash();
+                void* PairPtr = MapHelper.GetPairPtr(MapIndex);
+                DeserializePropertyValue(MapProperty->KeyProp, KeyPropertyType, PairPtr, Ar, bSkipDefaults);
+                DeserializePropertyValue(MapProperty->ValueProp, ValuePropertyType, PairPtr, Ar, bSkipDefaults);
+            }
+            MapHelper.Rehash();
+            return !Ar.IsError();
+        }
+
+        // All pairs are allocated up front, the columns are scattered into them and the map is rehashed once
+        TArray<uint8*> Pairs;
+        Pairs.Reserve(Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Pairs.Add(MapHelper.GetPairPtr(MapHelper.AddDefaultValue_Invalid_NeedsRehash()));
+        }
+        if (!DeserializeValueColumn(MapProperty->KeyProp, KeyPropertyType, bKeyPacked, Num, [&Pairs](int32 Index) { return Pairs[Index]; }, Ar, bSkipDefaults)
+            || !DeserializeValueColumn(MapProperty->ValueProp, ValuePropertyType, bValuePacked, Num, [&Pairs](int32 Index) { return Pairs[Index]; }, Ar, bSkipDefaults))
+        {
+            // Keys that were not loaded would all collide, a partially loaded map is not kept
+            MapHelper.EmptyValues();
+            return false;
+        }
+        MapHelper.Rehash();
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeSetProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
+{
+    if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        FProperty* ElementProperty = SetProperty->ElementProp;
+        FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(ObjectData));
+
+        // Same element layout as arrays: plain values for scalars, wrapper objects for everything else
+        TArray<TSharedPtr<FJsonValue>> JsonArray;
+        JsonArray.Reserve(SetHelper.Num());
+        const bool bScalar = IsScalarJsonProperty(ElementProperty);
+        for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+        {
+            if (!SetHelper.IsValidIndex(Index)) continue;
+
+            const void* ElementPtr = SetHelper.GetElementPtr(Index);
+            if (bScalar)
+            {
+                JsonArray.Add(MakeScalarJsonValue(ElementProperty, ElementPtr));
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> JsonObjectValue = MakeShared<FJsonObject>();
+            SerializeSubProperty(ElementProperty, ElementPtr, JsonObjectValue);
+            JsonArray.Add(MakeShared<FJsonValueObject>(JsonObjectValue));
+        }
+
+        JsonObject->SetArrayField(Property->GetName(), JsonArray);
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeSetProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
+{
+    if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+        if (!JsonObject->TryGetArrayField(Property->GetName(), JsonArray)) return false;
+
+        FProperty* ElementProperty = SetProperty->ElementProp;
+        FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(ObjectData));
+        SetHelper.EmptyElements(JsonArray->Num());
+        for (const TSharedPtr<FJsonValue>& JsonValue : *JsonArray)
+        {
+            const int32 SetIndex = SetHelper.AddDefaultValue_Invalid_NeedsRehash();
+            void* ElementPtr = SetHelper.GetElementPtr(SetIndex);
+
+            const TSharedPtr<FJsonObject>* JsonObjectValue;
+            if (JsonValue.IsValid() && JsonValue->Type != EJson::Object)
+            {
+                if (SetScalarJsonValue(ElementProperty, ElementPtr, JsonValue)) continue;
+            }
+            else if (JsonValue.IsValid() && JsonValue->TryGetObject(JsonObjectValue))
+            {
+                DeserializeSubProperty(ElementProperty, ElementPtr, *JsonObjectValue);
+                continue;
+            }
+            SetHelper.RemoveAt(SetIndex);
+        }
+
+        // Rehash the set once after adding all elements
+        SetHelper.Rehash();
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeSetProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        FProperty* ElementProperty = SetProperty->ElementProp;
+        FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(ObjectData));
+
+        // Same layout as the JSON object path
+        const bool bScalar = IsScalarJsonProperty(ElementProperty);
+        Writer.WriteArrayStart(Property->GetName());
+        for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+        {
+            if (!SetHelper.IsValidIndex(Index)) continue;
+
+            const void* ElementPtr = SetHelper.GetElementPtr(Index);
+            if (bScalar)
+            {
+                WriteScalarJsonValue(Writer, ElementProperty, ElementPtr);
+                continue;
+            }
+
+            Writer.WriteObjectStart();
+            SerializeSubProperty(ElementProperty, ElementPtr, Writer);
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteArrayEnd();
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeSetProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        if (Notation != EJsonNotation::ArrayStart) return SkipJsonValue(Reader, Notation);
+
+        FProperty* ElementProperty = SetProperty->ElementProp;
+        FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(ObjectData));
+        SetHelper.EmptyElements();
+
+        // Elements are either plain values or objects wrapping the value under the element property name
+        const FString ElementName = ElementProperty->GetName();
+        while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ArrayEnd)
+        {
+            const int32 SetIndex = SetHelper.AddDefaultValue_Invalid_NeedsRehash();
+            void* ElementPtr = SetHelper.GetElementPtr(SetIndex);
+            if (Notation != EJsonNotation::ObjectStart)
+            {
+                if (!ReadScalarJsonValue(ElementProperty, ElementPtr, Reader, Notation))
+                {
+                    SetHelper.RemoveAt(SetIndex);
+                    SkipJsonValue(Reader, Notation);
+                }
+                continue;
+            }
+            while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                if (Reader.GetIdentifier() == ElementName)
+                {
+                    DeserializeSubProperty(ElementProperty, ElementPtr, Reader, Notation);
+                }
+                else
+                {
+                    SkipJsonValue(Reader, Notation);
+                }
+            }
+        }
+
+        // Rehash the set once after adding all elements
+        SetHelper.Rehash();
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::SerializeSetProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(ObjectData));
+
+        // The elements are written as one typed column
+        const EPropertyType_SaveGSystem ElementPropertyType = GetPropertyType(SetProperty->ElementProp);
+        const bool bPacked = FSaveGPropertyPlan::IsBulkCopyable(SetProperty->ElementProp);
+        uint8 ElementType = static_cast<uint8>(ElementPropertyType) | (bPacked ? SaveGSystemSpace::PackedArrayFlag : 0);
+        int32 Num = SetHelper.Num();
+        Ar << ElementType;
+        Ar << Num;
+
+        TArray<uint8*> Elements;
+        Elements.Reserve(Num);
+        for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+        {
+            if (SetHelper.IsValidIndex(Index))
+            {
+                Elements.Add(SetHelper.GetElementPtr(Index));
+            }
+        }
+        SerializeValueColumn(SetProperty->ElementProp, ElementPropertyType, bPacked, Num, [&Elements](int32 Index) { return Elements[Index]; }, Ar, bSkipDefaults);
+        return true;
+    }
+    return false;
+}
+
+bool USaveGLibrary::DeserializeSetProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        uint8 ElementType = 0;
+        int32 Num = 0;
+        Ar << ElementType;
+        Ar << Num;
+        const bool bPacked = (ElementType & SaveGSystemSpace::PackedArrayFlag) != 0;
+        ElementType &= ~SaveGSystemSpace::PackedArrayFlag;
+        const EPropertyType_SaveGSystem ElementPropertyType = GetPropertyType(SetProperty->ElementProp);
+        if (ElementType != static_cast<uint8>(ElementPropertyType)) return false;
+        if (!IsValidContainerNum(Ar, Num)) return false;
+
+        // All elements are allocated up front, the column is scattered into them and the set is rehashed once
+        FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(ObjectData));
+        SetHelper.EmptyElements(Num);
+        TArray<uint8*> Elements;
+        Elements.Reserve(Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Elements.Add(SetHelper.GetElementPtr(SetHelper.AddDefaultValue_Invalid_NeedsRehash()));
+        }
+        if (!DeserializeValueColumn(SetProperty->ElementProp, ElementPropertyType, bPacked, Num, [&Elements](int32 Index) { return Elements[Index]; }, Ar, bSkipDefaults))
+        {
+            SetHelper.EmptyElements();
+            return false;
+        }
+        SetHelper.Rehash();
+        return true;
+    }
+    return false;
+}
+
 void USaveGLibrary::SerializeSubProperty(FProperty* SubProperty, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
 {
     if (SerializeBoolProperty(SubProperty, ObjectData, JsonObject)) return;
@@ -949,6 +2483,7 @@ void USaveGLibrary::SerializeSubProperty(FProperty* SubProperty, const void* Obj
     if (SerializeStructProperty(SubProperty, ObjectData, JsonObject)) return;
     if (SerializeArrayProperty(SubProperty, ObjectData, JsonObject)) return;
     if (SerializeMapProperty(SubProperty, ObjectData, JsonObject)) return;
+    if (SerializeSetProperty(SubProperty, ObjectData, JsonObject)) return;
 }
 
 void USaveGLibrary::DeserializeSubProperty(FProperty* SubProperty, void* ObjectData, TSharedPtr<FJsonObject> JsonObject)
@@ -961,6 +2496,436 @@ void USaveGLibrary::DeserializeSubProperty(FProperty* SubProperty, void* ObjectD
     if (DeserializeStructProperty(SubProperty, ObjectData, JsonObject)) return;
     if (DeserializeArrayProperty(SubProperty, ObjectData, JsonObject)) return;
     if (DeserializeMapProperty(SubProperty, ObjectData, JsonObject)) return;
+    if (DeserializeSetProperty(SubProperty, ObjectData, JsonObject)) return;
+}
+
+void USaveGLibrary::SerializeSubProperty(FProperty* SubProperty, const void* ObjectData, FSaveGJsonWriter& Writer)
+{
+    if (SerializeBoolProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeByteProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeStringProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeNumericProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeObjectProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeStructProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeArrayProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeMapProperty(SubProperty, ObjectData, Writer)) return;
+    if (SerializeSetProperty(SubProperty, ObjectData, Writer)) return;
+}
+
+void USaveGLibrary::DeserializeSubProperty(FProperty* SubProperty, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation)
+{
+    if (DeserializeBoolProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeByteProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeStringProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeNumericProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeObjectProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeStructProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeArrayProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeMapProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    if (DeserializeSetProperty(SubProperty, ObjectData, Reader, Notation)) return;
+    SkipJsonValue(Reader, Notation);
+}
+
+void USaveGLibrary::DeserializePropertyBlock(const FSaveGPropertyPlan& Plan, void* ObjectData, FSaveGJsonReader& Reader)
+{
+    EJsonNotation Notation;
+    while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+    {
+        // A field name that was never made into an FName can't belong to any property
+        const FName Name(*Reader.GetIdentifier(), FNAME_Find);
+        const FPropertyPlanEntry_SaveGSystem* Entry = Name.IsNone() ? nullptr : Plan.FindEntry(Name);
+        if (Entry)
+        {
+            DeserializeSubProperty(Entry->Property, ObjectData, Reader, Notation);
+        }
+        else
+        {
+            SkipJsonValue(Reader, Notation);
+        }
+    }
+}
+
+bool USaveGLibrary::SerializePropertyValue(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    return SerializePropertyValue(Property, GetPropertyType(Property), ObjectData, Ar, bSkipDefaults);
+}
+
+bool USaveGLibrary::DeserializePropertyValue(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    return DeserializePropertyValue(Property, GetPropertyType(Property), ObjectData, Ar, bSkipDefaults);
+}
+
+bool USaveGLibrary::SerializePropertyValue(FProperty* Property, EPropertyType_SaveGSystem Type, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    switch (Type)
+    {
+        case EPropertyType_SaveGSystem::Bool: return SerializeBoolProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::Byte:
+        case EPropertyType_SaveGSystem::Enum: return SerializeByteProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::Str:
+        case EPropertyType_SaveGSystem::Name:
+        case EPropertyType_SaveGSystem::Text: return SerializeStringProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::SoftClass:
+        case EPropertyType_SaveGSystem::SoftObject: return SerializeObjectProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::Struct: return SerializeStructProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::Array: return SerializeArrayProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::Map: return SerializeMapProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::Set: return SerializeSetProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::None: return false;
+        default: return SerializeNumericProperty(Property, ObjectData, Ar);
+    }
+}
+
+bool USaveGLibrary::DeserializePropertyValue(FProperty* Property, EPropertyType_SaveGSystem Type, void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    switch (Type)
+    {
+        case EPropertyType_SaveGSystem::Bool: return DeserializeBoolProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::Byte:
+        case EPropertyType_SaveGSystem::Enum: return DeserializeByteProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::Str:
+        case EPropertyType_SaveGSystem::Name:
+        case EPropertyType_SaveGSystem::Text: return DeserializeStringProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::SoftClass:
+        case EPropertyType_SaveGSystem::SoftObject: return DeserializeObjectProperty(Property, ObjectData, Ar);
+        case EPropertyType_SaveGSystem::Struct: return DeserializeStructProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::Array: return DeserializeArrayProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::Map: return DeserializeMapProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::Set: return DeserializeSetProperty(Property, ObjectData, Ar, bSkipDefaults);
+        case EPropertyType_SaveGSystem::None: return false;
+        default: return DeserializeNumericProperty(Property, ObjectData, Ar);
+    }
+}
+
+void USaveGLibrary::SerializeSubProperty(const FPropertyPlanEntry_SaveGSystem& Entry, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    // Tag: name, type and size of the payload, so that the reader can skip unknown or changed properties
+    FName Name = Entry.Name;
+    uint8 Type = static_cast<uint8>(Entry.Type);
+    int32 Size = 0;
+    Ar << Name;
+    Ar << Type;
+    const int64 SizePos = Ar.Tell();
+    Ar << Size;
+
+    SerializePropertyValue(Entry.Property, Entry.Type, ObjectData, Ar, bSkipDefaults);
+
+    // Go back and patch the size of the payload
+    const int64 EndPos = Ar.Tell();
+    Size = static_cast<int32>(EndPos - SizePos - sizeof(int32));
+    Ar.Seek(SizePos);
+    Ar << Size;
+    Ar.Seek(EndPos);
+}
+
+void USaveGLibrary::SerializePropertyBlock(const FSaveGPropertyPlan& Plan, const void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    const void* DefaultData = bSkipDefaults ? Plan.GetDefaults() : nullptr;
+
+    // The count is patched once it is known how many properties differ from the defaults
+    int32 Count = 0;
+    const int64 CountPos = Ar.Tell();
+    Ar << Count;
+    for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan.GetEntries())
+    {
+        if (DefaultData && ObjectData != DefaultData && Entry.Property->Identical_InContainer(ObjectData, DefaultData)) continue;
+        SerializeSubProperty(Entry, ObjectData, Ar, bSkipDefaults);
+        ++Count;
+    }
+
+    const int64 EndPos = Ar.Tell();
+    Ar.Seek(CountPos);
+    Ar << Count;
+    Ar.Seek(EndPos);
+}
+
+void USaveGLibrary::DeserializePropertyBlock(const FSaveGPropertyPlan& Plan, void* ObjectData, FArchive& Ar, bool bSkipDefaults)
+{
+    int32 Count = 0;
+    Ar << Count;
+    if (!IsValidContainerNum(Ar, Count)) return;
+
+    // Properties that were omitted for being equal to the defaults are restored from them
+    const void* DefaultData = bSkipDefaults ? Plan.GetDefaults() : nullptr;
+    TBitArray<> Loaded(false, DefaultData ? Plan.GetEntries().Num() : 0);
+
+    for (int32 Index = 0; Index < Count && !Ar.IsError(); ++Index)
+    {
+        FName Name;
+        uint8 Type = 0;
+        int32 Size = 0;
+        Ar << Name;
+        Ar << Type;
+        Ar << Size;
+        const int64 EndPos = Ar.Tell() + Size;
+        if (Size < 0 || EndPos > Ar.TotalSize())
+        {
+            Ar.SetError();
+            return;
+        }
+
+        // Properties that were removed or changed their type since saving are skipped
+        const FPropertyPlanEntry_SaveGSystem* Entry = Plan.FindEntry(Name);
+        if (Entry && static_cast<uint8>(Entry->Type) == Type)
+        {
+            DeserializePropertyValue(Entry->Property, Entry->Type, ObjectData, Ar, bSkipDefaults);
+            if (DefaultData)
+            {
+                Loaded[Entry - Plan.GetEntries().GetData()] = true;
+            }
+        }
+        if (Ar.IsError()) return;
+        Ar.Seek(EndPos);
+    }
+
+    if (!DefaultData || ObjectData == DefaultData) return;
+    for (int32 Index = 0; Index < Loaded.Num(); ++Index)
+    {
+        if (Loaded[Index]) continue;
+        const FPropertyPlanEntry_SaveGSystem& Entry = Plan.GetEntries()[Index];
+        Entry.Property->CopyCompleteValue_InContainer(ObjectData, DefaultData);
+    }
+}
+
+void USaveGLibrary::SerializeStructColumns(const FSaveGPropertyPlan& Plan, FScriptArrayHelper& ArrayHelper, FArchive& Ar, bool bSkipDefaults)
+{
+    const void* DefaultData = bSkipDefaults ? Plan.GetDefaults() : nullptr;
+    const int32 Num = ArrayHelper.Num();
+
+    int32 Count = 0;
+    const int64 CountPos = Ar.Tell();
+    Ar << Count;
+    for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan.GetEntries())
+    {
+        if (DefaultData)
+        {
+            bool bAllDefault = true;
+            for (int32 Index = 0; Index < Num && bAllDefault; ++Index)
+            {
+                bAllDefault = Entry.Property->Identical_InContainer(ArrayHelper.GetRawPtr(Index), DefaultData);
+            }
+            if (bAllDefault) continue;
+        }
+
+        // Same tag as a single property, the packed flag on the type marks a column of raw values
+        const bool bPacked = FSaveGPropertyPlan::IsBulkCopyable(Entry.Property);
+        FName Name = Entry.Name;
+        uint8 Type = static_cast<uint8>(Entry.Type) | (bPacked ? SaveGSystemSpace::PackedArrayFlag : 0);
+        int32 Size = 0;
+        Ar << Name;
+        Ar << Type;
+        const int64 SizePos = Ar.Tell();
+        Ar << Size;
+
+        SerializeValueColumn(Entry.Property, Entry.Type, bPacked, Num, [&ArrayHelper](int32 Index) { return ArrayHelper.GetRawPtr(Index); }, Ar, bSkipDefaults);
+
+        const int64 EndPos = Ar.Tell();
+        Size = static_cast<int32>(EndPos - SizePos - sizeof(int32));
+        Ar.Seek(SizePos);
+        Ar << Size;
+        Ar.Seek(EndPos);
+        ++Count;
+    }
+
+    const int64 EndPos = Ar.Tell();
+    Ar.Seek(CountPos);
+    Ar << Count;
+    Ar.Seek(EndPos);
+}
+
+void USaveGLibrary::DeserializeStructColumns(const FSaveGPropertyPlan& Plan, FScriptArrayHelper& ArrayHelper, FArchive& Ar, bool bSkipDefaults)
+{
+    int32 Count = 0;
+    Ar << Count;
+    if (!IsValidContainerNum(Ar, Count)) return;
+
+    const void* DefaultData = bSkipDefaults ? Plan.GetDefaults() : nullptr;
+    TBitArray<> Loaded(false, DefaultData ? Plan.GetEntries().Num() : 0);
+    const int32 Num = ArrayHelper.Num();
+
+    for (int32 ColumnIndex = 0; ColumnIndex < Count && !Ar.IsError(); ++ColumnIndex)
+    {
+        FName Name;
+        uint8 Type = 0;
+        int32 Size = 0;
+        Ar << Name;
+        Ar << Type;
+        Ar << Size;
+        const int64 EndPos = Ar.Tell() + Size;
+        if (Size < 0 || EndPos > Ar.TotalSize())
+        {
+            Ar.SetError();
+            return;
+        }
+
+        const bool bPacked = (Type & SaveGSystemSpace::PackedArrayFlag) != 0;
+        Type &= ~SaveGSystemSpace::PackedArrayFlag;
+
+        // Columns of fields that were removed or changed their type or layout since saving are skipped
+        const FPropertyPlanEntry_SaveGSystem* Entry = Plan.FindEntry(Name);
+        if (Entry && static_cast<uint8>(Entry->Type) == Type)
+        {
+            const bool bLoaded = DeserializeValueColumn(Entry->Property, Entry->Type, bPacked, Num, [&ArrayHelper](int32 Index) { return ArrayHelper.GetRawPtr(Index); }, Ar, bSkipDefaults);
+            if (DefaultData && bLoaded)
+            {
+                Loaded[Entry - Plan.GetEntries().GetData()] = true;
+            }
+        }
+        if (Ar.IsError()) return;
+        Ar.Seek(EndPos);
+    }
+
+    if (!DefaultData) return;
+    for (int32 EntryIndex = 0; EntryIndex < Loaded.Num(); ++EntryIndex)
+    {
+        if (Loaded[EntryIndex]) continue;
+        const FPropertyPlanEntry_SaveGSystem& Entry = Plan.GetEntries()[EntryIndex];
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Entry.Property->CopyCompleteValue_InContainer(ArrayHelper.GetRawPtr(Index), DefaultData);
+        }
+    }
+}
+
+bool USaveGLibrary::SerializeObject(UObject* Object, FTagData_SaveGSystem& OutSaveData)
+{
+    if (OutSaveData.Format == ESerializeFormat_SaveGSystem::Binary)
+    {
+        return SerializeObjectBinary(Object, OutSaveData.Data, OutSaveData.Names, OutSaveData.bSkipDefaultValues);
+    }
+
+    OutSaveData.Names.Reset();
+    return SerializeObjectJson(Object, OutSaveData.Data);
+}
+
+bool USaveGLibrary::SerializeSnapshot(const FSaveGPropertySnapshot& Snapshot, FTagData_SaveGSystem& OutSaveData)
+{
+    if (CLOG_SAVE_G_SYSTEM(!Snapshot.IsValid(), "Snapshot is not valid")) return false;
+
+    if (OutSaveData.Format == ESerializeFormat_SaveGSystem::Binary)
+    {
+        return SerializePropertiesBinary(Snapshot.GetPlan(), Snapshot.GetData(), OutSaveData.Data, OutSaveData.Names, OutSaveData.bSkipDefaultValues);
+    }
+
+    OutSaveData.Names.Reset();
+    return SerializePropertiesJson(Snapshot.GetPlan(), Snapshot.GetData(), OutSaveData.Data);
+}
+
+bool USaveGLibrary::DeserializeObject(UObject* Object, const FTagData_SaveGSystem& SaveData)
+{
+    if (SaveData.Format == ESerializeFormat_SaveGSystem::Binary)
+    {
+        return DeserializeObjectBinary(Object, SaveData.Data, SaveData.Names);
+    }
+    return DeserializeObjectJson(Object, SaveData.Data);
+}
+
+FString USaveGLibrary::SerializeObjectJson(UObject* Object)
+{
+    if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return {};
+
+    TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+    const FSaveGPropertyPlanRef Plan = FSaveGPropertyPlan::Get(Object->GetClass());
+    for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan->GetEntries())
+    {
+        SerializeSubProperty(Entry.Property, Object, JsonObject);
+    }
+    return ConvertJsonObjectToString(JsonObject);
+}
+
+bool USaveGLibrary::SerializeObjectJson(UObject* Object, TArray<uint8>& OutData)
+{
+    if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return false;
+
+    return SerializePropertiesJson(*FSaveGPropertyPlan::Get(Object->GetClass()), Object, OutData);
+}
+
+bool USaveGLibrary::SerializePropertiesJson(const FSaveGPropertyPlan& Plan, const void* ObjectData, TArray<uint8>& OutData)
+{
+    OutData.Reset();
+    FMemoryWriter Ar(OutData);
+    TSharedRef<FSaveGJsonWriter> Writer = TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Ar);
+    Writer->WriteObjectStart();
+    for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan.GetEntries())
+    {
+        SerializeSubProperty(Entry.Property, ObjectData, *Writer);
+    }
+    Writer->WriteObjectEnd();
+    return Writer->Close() && !Ar.IsError();
+}
+
+bool USaveGLibrary::DeserializeObjectJson(UObject* Object, const FString& JsonString)
+{
+    if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return false;
+
+    TSharedPtr<FJsonObject> JsonObject = ConvertStringToJsonObject(JsonString);
+    if (CLOG_SAVE_G_SYSTEM(!JsonObject.IsValid(), "JsonObject is not valid reader")) return false;
+
+    const FSaveGPropertyPlanRef Plan = FSaveGPropertyPlan::Get(Object->GetClass());
+    for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan->GetEntries())
+    {
+        DeserializeSubProperty(Entry.Property, Object, JsonObject);
+    }
+    return true;
+}
+
+bool USaveGLibrary::DeserializeObjectJson(UObject* Object, const TArray<uint8>& Data)
+{
+    if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return false;
+
+    // The reader works on wide characters, the conversion is a single pass and no JSON object tree is built
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data.GetData()), Data.Num());
+    TSharedRef<FSaveGJsonReader> Reader = TJsonReaderFactory<>::CreateFromView(FStringView(Converter.Get(), Converter.Length()));
+
+    EJsonNotation Notation;
+    if (CLOG_SAVE_G_SYSTEM(!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart, "JSON data of object %s is not valid", *Object->GetName())) return false;
+
+    DeserializePropertyBlock(*FSaveGPropertyPlan::Get(Object->GetClass()), Object, *Reader);
+    return !CLOG_SAVE_G_SYSTEM(!Reader->GetErrorMessage().IsEmpty(), "JSON data of object %s is corrupted: %s", *Object->GetName(), *Reader->GetErrorMessage());
+}
+
+bool USaveGLibrary::SerializeObjectBinary(UObject* Object, TArray<uint8>& OutData, TArray<FName>& OutNames, bool bSkipDefaultValues)
+{
+    if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return false;
+
+    return SerializePropertiesBinary(*FSaveGPropertyPlan::Get(Object->GetClass()), Object, OutData, OutNames, bSkipDefaultValues);
+}
+
+bool USaveGLibrary::SerializePropertiesBinary(const FSaveGPropertyPlan& Plan, const void* ObjectData, TArray<uint8>& OutData, TArray<FName>& OutNames, bool bSkipDefaultValues)
+{
+    OutData.Reset();
+    FSaveGNameTableWriter Writer(OutData, OutNames);
+    uint16 Version = SaveGSystemSpace::BinaryVersion;
+    uint8 Flags = bSkipDefaultValues ? SaveGSystemSpace::BinaryFlagSkipDefaults : 0;
+    Writer << Version;
+    Writer << Flags;
+    SerializePropertyBlock(Plan, ObjectData, Writer, bSkipDefaultValues);
+    return !Writer.IsError();
+}
+
+bool USaveGLibrary::DeserializeObjectBinary(UObject* Object, const TArray<uint8>& Data, const TArray<FName>& Names)
+{
+    if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return false;
+
+    FMemoryReader LegacyReader(Data);
+    uint16 Version = 0;
+    LegacyReader << Version;
+    if (CLOG_SAVE_G_SYSTEM(Version == 0 || Version > SaveGSystemSpace::BinaryVersion, "Unsupported binary version: %i", Version)) return false;
+
+    uint8 Flags = 0;
+    if (Version >= 3)
+    {
+        LegacyReader << Flags;
+    }
+
+    // Streams of the first version store names as strings instead of name table indices
+    FSaveGNameTableReader NameTableReader(Data, Names);
+    NameTableReader.Seek(LegacyReader.Tell());
+    FArchive& Reader = Version == 1 ? static_cast<FArchive&>(LegacyReader) : NameTableReader;
+    const bool bSkipDefaults = (Flags & SaveGSystemSpace::BinaryFlagSkipDefaults) != 0;
+
+    DeserializePropertyBlock(*FSaveGPropertyPlan::Get(Object->GetClass()), Object, Reader, bSkipDefaults);
+    return !CLOG_SAVE_G_SYSTEM(Reader.IsError(), "Binary data of object %s is corrupted", *Object->GetName());
 }
 
 FString USaveGLibrary::ValidateFileName(const FString& FileName)
@@ -4,15 +4,31 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "SaveGSystem/Data/SaveGSystemDataTypes.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
 #include "SaveGLibrary.generated.h"
 
+class FSaveGPropertyPlan;
+class FSaveGPropertySnapshot;
+class FScriptArrayHelper;
+struct FPropertyPlanEntry_SaveGSystem;
+
+/** Condensed JSON writer that emits UTF-8 straight into an archive **/
+using FSaveGJsonWriter = TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>;
+
+/** Token reader used to load JSON without building a JSON object tree **/
+using FSaveGJsonReader = TJsonReader<TCHAR>;
+
 /**
  * Library for working with SaveGSystem.
  * Provides functionality for:
  * 1. Data compression and decompression.
  * 2. Reading and writing data.
  * 3. Finding properties with specific metadata.
- * 4. Serializing and deserializing properties (String, Byte, Enum, Numeric, Object, Bool, Struct, Array, Map).
+ * 4. Serializing and deserializing properties (String, Byte, Enum, Numeric, Object, Bool, Struct, Array, Map, Set).
+ * 5. Serializing and deserializing whole objects into JSON or a tagged binary stream.
  */
 UCLASS()
 class SAVEGSYSTEM_API USaveGLibrary : public UBlueprintFunctionLibrary
@@ -20,7 +36,7 @@ class SAVEGSYSTEM_API USaveGLibrary : public UBlueprintFunctionLibrary
     GENERATED_BODY()
 
 public:
-    /** @public Compresses a byte array using a compression algorithm. **/
+    /** @public Compresses a byte array with the codec and level of the settings. **/
     UFUNCTION(BlueprintCallable, Category = "SaveGLibrary | Compression")
     static bool CompressData(TArray<uint8>& SomeData, TArray<uint8>& OutData);
 
@@ -28,6 +44,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "SaveGLibrary | Compression")
     static bool DecompressData(const TArray<uint8>& CompressedData, TArray<uint8>& OutData);
 
+    /**
+     * @public Compresses the data in independent chunks on up to NumWorkers threads, 0 uses every worker thread.
+     * Layout: magic, version, codec, flags, chunk size, raw size, number of chunks, compressed size of every chunk, then the chunks.
+     * A payload that does not get smaller is stored raw right after the header.
+     */
+    static bool CompressDataParallel(TConstArrayView<uint8> Data, TArray<uint8>& OutData, ECompressionCodec_SaveGSystem Codec,
+        ECompressionLevel_SaveGSystem Level = ECompressionLevel_SaveGSystem::Normal, int32 NumWorkers = 0);
+
+    /** @public Decompresses the chunks on up to NumWorkers threads, 0 uses every worker thread. The codec is read from the data, data of older versions is read as one stream **/
+    static bool DecompressDataParallel(TConstArrayView<uint8> CompressedData, TArray<uint8>& OutData, int32 NumWorkers = 0);
+
     /** @public Converts a JSON object to a string representation. **/
     static FString ConvertJsonObjectToString(const TSharedPtr<FJsonObject>& JsonObject);
 
@@ -40,82 +67,169 @@ public:
     /** @public Converts a byte array to a string. **/
     static FString ConvertByteToString(const TArray<uint8>& ByteArray);
 
-    /** @public Retrieves all properties of an object that have the "SaveGame" metadata. **/
+    /** @public Retrieves all properties of an object that have the SaveGame flag. **/
     static TArray<FProperty*> GetAllPropertyHasMetaSaveGame(const UObject* ObjectData);
 
     /** @public Retrieves all properties of an object that have a specific custom metadata. **/
     static TArray<FProperty*> GetAllPropertyHasCustomMeta(const UObject* ObjectData, const FName& MetaName);
 
+    /** @public Returns the type under which a property is written to the tagged binary stream. **/
+    static EPropertyType_SaveGSystem GetPropertyType(const FProperty* Property);
+
     /** @public Serializes a boolean property to a JSON object. **/
     static bool SerializeBoolProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes a boolean property from a JSON object. **/
     static bool DeserializeBoolProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes a boolean property straight to a JSON writer. **/
+    static bool SerializeBoolProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a boolean property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeBoolProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
     /** @public Serializes a boolean property to a FString. **/
     static bool SerializeBoolProperty(FProperty* Property, const void* ObjectData, FString& Str);
 
     /** @public Deserializes a boolean property from a FString. **/
     static bool DeserializeBoolProperty(FProperty* Property, void* ObjectData, const FString& Str);
 
+    /** @public Serializes a boolean property to a binary archive. **/
+    static bool SerializeBoolProperty(FProperty* Property, const void* ObjectData, FArchive& Ar);
+
+    /** @public Deserializes a boolean property from a binary archive. **/
+    static bool DeserializeBoolProperty(FProperty* Property, void* ObjectData, FArchive& Ar);
+
     /** @public Serializes a byte property (or enum) to a JSON object. **/
     static bool SerializeByteProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes a byte property (or enum) from a JSON object. **/
     static bool DeserializeByteProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes a byte or enum property straight to a JSON writer. **/
+    static bool SerializeByteProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a byte or enum property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeByteProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
     /** @public Serializes a byte property (or enum) to a FString. **/
     static bool SerializeByteProperty(FProperty* Property, const void* ObjectData, FString& Str);
 
     /** @public Deserializes a byte property (or enum) from a FString. **/
     static bool DeserializeByteProperty(FProperty* Property, void* ObjectData, const FString& Str);
 
+    /** @public Serializes a byte property (or enum) to a binary archive. **/
+    static bool SerializeByteProperty(FProperty* Property, const void* ObjectData, FArchive& Ar);
+
+    /** @public Deserializes a byte property (or enum) from a binary archive. **/
+    static bool DeserializeByteProperty(FProperty* Property, void* ObjectData, FArchive& Ar);
+
     /** @public Serializes a string, name, or text property to a JSON object. **/
     static bool SerializeStringProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes a string, name, or text property from a JSON object. **/
     static bool DeserializeStringProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes a string property straight to a JSON writer. **/
+    static bool SerializeStringProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a string property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeStringProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
     /** @public Serializes a string, name, or text property to a FString. **/
     static bool SerializeStringProperty(FProperty* Property, const void* ObjectData, FString& Str);
 
     /** @public Deserializes a string, name, or text property from a FString. **/
     static bool DeserializeStringProperty(FProperty* Property, void* ObjectData, const FString& Str);
 
+    /** @public Serializes a string, name, or text property to a binary archive. **/
+    static bool SerializeStringProperty(FProperty* Property, const void* ObjectData, FArchive& Ar);
+
+    /** @public Deserializes a string, name, or text property from a binary archive. **/
+    static bool DeserializeStringProperty(FProperty* Property, void* ObjectData, FArchive& Ar);
+
     /** @public Serializes a numeric property (int, float, double, etc.) to a JSON object. **/
     static bool SerializeNumericProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes a numeric property (int, float, double, etc.) from a JSON object. **/
     static bool DeserializeNumericProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes a numeric property straight to a JSON writer. **/
+    static bool SerializeNumericProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a numeric property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeNumericProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
     /** @public Serializes a numeric property (int, float, double, etc.) to a FString. **/
     static bool SerializeNumericProperty(FProperty* Property, const void* ObjectData, FString& Str);
 
     /** @public Deserializes a numeric property (int, float, double, etc.) from a FString. **/
     static bool DeserializeNumericProperty(FProperty* Property, void* ObjectData, const FString& Str);
 
+    /** @public Serializes a numeric property (int, float, double, etc.) to a binary archive. **/
+    static bool SerializeNumericProperty(FProperty* Property, const void* ObjectData, FArchive& Ar);
+
+    /** @public Deserializes a numeric property (int, float, double, etc.) from a binary archive. **/
+    static bool DeserializeNumericProperty(FProperty* Property, void* ObjectData, FArchive& Ar);
+
     /** @public Serializes an object property (UObject, soft object, etc.) to a JSON object. **/
     static bool SerializeObjectProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes an object property (UObject, soft object, etc.) from a JSON object. **/
     static bool DeserializeObjectProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes an object property straight to a JSON writer. **/
+    static bool SerializeObjectProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes an object property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeObjectProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
+    /** @public Serializes an object property (UObject, soft object, etc.) to a binary archive. **/
+    static bool SerializeObjectProperty(FProperty* Property, const void* ObjectData, FArchive& Ar);
+
+    /** @public Deserializes an object property (UObject, soft object, etc.) from a binary archive. **/
+    static bool DeserializeObjectProperty(FProperty* Property, void* ObjectData, FArchive& Ar);
+
     /** @public Serializes a struct property to a JSON object. **/
     static bool SerializeStructProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes a struct property from a JSON object. **/
     static bool DeserializeStructProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes a struct property straight to a JSON writer. **/
+    static bool SerializeStructProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a struct property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeStructProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
+    /** @public Serializes a struct property to a binary archive. **/
+    static bool SerializeStructProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes a struct property from a binary archive. **/
+    static bool DeserializeStructProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
     /** @public Serializes an array property to a JSON object. **/
     static bool SerializeArrayProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes an array property from a JSON object. **/
     static bool DeserializeArrayProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
-    /** @public Serializes a map key or value based on its property type. **/
+    /** @public Serializes an array property straight to a JSON writer. **/
+    static bool SerializeArrayProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes an array property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeArrayProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
+    /** @public Serializes an array property to a binary archive. **/
+    static bool SerializeArrayProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes an array property from a binary archive. **/
+    static bool DeserializeArrayProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Serializes a map key or value based on its property type. Keys without a plain string form use the engine text export. **/
     static FString SerializeMapKeyValue(FProperty* Property, const void* Ptr);
 
-    /** @public Deserializes a map key or value based on its property type. **/
+    /** @public Deserializes a map key or value based on its property type. Keys without a plain string form use the engine text import. **/
     static bool DeserializeMapKeyValue(FProperty* Property, void* Ptr, const FString& DataString);
 
     /** @public Serializes a map property to a JSON object. **/
@@ -124,12 +238,116 @@ public:
     /** @public Deserializes a map property from a JSON object. **/
     static bool DeserializeMapProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes a map property straight to a JSON writer. **/
+    static bool SerializeMapProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a map property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeMapProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
+    /** @public Serializes a map property to a binary archive. **/
+    static bool SerializeMapProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes a map property from a binary archive. **/
+    static bool DeserializeMapProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Serializes a set property to a JSON object. **/
+    static bool SerializeSetProperty(FProperty* Property, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
+
+    /** @public Deserializes a set property from a JSON object. **/
+    static bool DeserializeSetProperty(FProperty* Property, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
+
+    /** @public Serializes a set property straight to a JSON writer. **/
+    static bool SerializeSetProperty(FProperty* Property, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a set property from the value a JSON reader has just started. Returns false without consuming anything if the type differs. **/
+    static bool DeserializeSetProperty(FProperty* Property, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
+    /** @public Serializes a set property to a binary archive. **/
+    static bool SerializeSetProperty(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes a set property from a binary archive. **/
+    static bool DeserializeSetProperty(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
     /** @public Serializes a sub-property (recursively handles nested properties). **/
     static void SerializeSubProperty(FProperty* SubProperty, const void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
     /** @public Deserializes a sub-property (recursively handles nested properties). **/
     static void DeserializeSubProperty(FProperty* SubProperty, void* ObjectData, TSharedPtr<FJsonObject> JsonObject);
 
+    /** @public Serializes a sub-property straight to a JSON writer (recursively handles nested properties). **/
+    static void SerializeSubProperty(FProperty* SubProperty, const void* ObjectData, FSaveGJsonWriter& Writer);
+
+    /** @public Deserializes a sub-property from the value a JSON reader has just started, skipping values it can't apply. **/
+    static void DeserializeSubProperty(FProperty* SubProperty, void* ObjectData, FSaveGJsonReader& Reader, EJsonNotation Notation);
+
+    /** @public Deserializes the fields of a JSON object whose start was just read, dispatching each field through the plan. **/
+    static void DeserializePropertyBlock(const FSaveGPropertyPlan& Plan, void* ObjectData, FSaveGJsonReader& Reader);
+
+    /** @public Serializes the value of a property to a binary archive without a tag. **/
+    static bool SerializePropertyValue(FProperty* Property, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes the value of a property from a binary archive without a tag. **/
+    static bool DeserializePropertyValue(FProperty* Property, void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Serializes the value of a property of an already known type to a binary archive without a tag. **/
+    static bool SerializePropertyValue(FProperty* Property, EPropertyType_SaveGSystem Type, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes the value of a property of an already known type from a binary archive without a tag. **/
+    static bool DeserializePropertyValue(FProperty* Property, EPropertyType_SaveGSystem Type, void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Serializes a tagged sub-property (name, type and size) to a binary archive. **/
+    static void SerializeSubProperty(const FPropertyPlanEntry_SaveGSystem& Entry, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Serializes the properties of a plan as a block of tagged properties to a binary archive.
+     * With bSkipDefaults, properties equal to the defaults of the plan are omitted, also inside nested structs and containers. **/
+    static void SerializePropertyBlock(const FSaveGPropertyPlan& Plan, const void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes a block of tagged properties from a binary archive, skipping unknown or changed tags.
+     * With bSkipDefaults, properties missing from the block are reset to the defaults of the plan. **/
+    static void DeserializePropertyBlock(const FSaveGPropertyPlan& Plan, void* ObjectData, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Serializes the elements of an array of structs column by column: every value of one field, then the next field.
+     * Plain fields are written as raw memory. With bSkipDefaults, fields equal to the defaults in every element are omitted. **/
+    static void SerializeStructColumns(const FSaveGPropertyPlan& Plan, FScriptArrayHelper& ArrayHelper, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Deserializes columns of struct fields into the already sized elements of an array, skipping unknown or changed columns.
+     * With bSkipDefaults, columns missing from the stream are reset to the defaults of the plan. **/
+    static void DeserializeStructColumns(const FSaveGPropertyPlan& Plan, FScriptArrayHelper& ArrayHelper, FArchive& Ar, bool bSkipDefaults);
+
+    /** @public Serializes all SaveGame properties of an object in the requested format. **/
+    static bool SerializeObject(UObject* Object, FTagData_SaveGSystem& OutSaveData);
+
+    /** @public Serializes the property values of a snapshot in the requested format. Doesn't touch any UObject, so it can run on a worker thread. **/
+    static bool SerializeSnapshot(const FSaveGPropertySnapshot& Snapshot, FTagData_SaveGSystem& OutSaveData);
+
+    /** @public Deserializes all SaveGame properties of an object from data in the requested format. **/
+    static bool DeserializeObject(UObject* Object, const FTagData_SaveGSystem& SaveData);
+
+    /** @public Serializes all SaveGame properties of an object to a JSON string. **/
+    static FString SerializeObjectJson(UObject* Object);
+
+    /** @public Serializes all SaveGame properties of an object to condensed UTF-8 JSON without building a JSON object tree. **/
+    static bool SerializeObjectJson(UObject* Object, TArray<uint8>& OutData);
+
+    /** @public Serializes the properties of a plan to condensed UTF-8 JSON. **/
+    static bool SerializePropertiesJson(const FSaveGPropertyPlan& Plan, const void* ObjectData, TArray<uint8>& OutData);
+
+    /** @public Deserializes all SaveGame properties of an object from a JSON string. **/
+    static bool DeserializeObjectJson(UObject* Object, const FString& JsonString);
+
+    /** @public Deserializes all SaveGame properties of an object from UTF-8 JSON in a single pass over its tokens. **/
+    static bool DeserializeObjectJson(UObject* Object, const TArray<uint8>& Data);
+
+    /** @public Serializes all SaveGame properties of an object to a versioned tagged binary stream, collecting its names into a name table.
+     * With bSkipDefaultValues, properties equal to the class default object or the struct defaults are omitted. **/
+    static bool SerializeObjectBinary(UObject* Object, TArray<uint8>& OutData, TArray<FName>& OutNames, bool bSkipDefaultValues = false);
+
+    /** @public Serializes the properties of a plan to a versioned tagged binary stream, collecting its names into a name table. **/
+    static bool SerializePropertiesBinary(const FSaveGPropertyPlan& Plan, const void* ObjectData, TArray<uint8>& OutData, TArray<FName>& OutNames, bool bSkipDefaultValues = false);
+
+    /** @public Deserializes all SaveGame properties of an object from a versioned tagged binary stream and its name table. **/
+    static bool DeserializeObjectBinary(UObject* Object, const TArray<uint8>& Data, const TArray<FName>& Names);
+
     /** @public Validates a file name by removing invalid characters. **/
     static FString ValidateFileName(const FString& FileName);
 };
\ No newline at end of file
@@ -0,0 +1,36 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SaveGNameTableArchive.h"
+
+FSaveGNameTableWriter::FSaveGNameTableWriter(TArray<uint8>& InBytes, TArray<FName>& InNames) : FMemoryWriter(InBytes), Names(InNames)
+{
+    Names.Reset();
+}
+
+FArchive& FSaveGNameTableWriter::operator<<(FName& Name)
+{
+    int32& Index = NameToIndex.FindOrAdd(Name, INDEX_NONE);
+    if (Index == INDEX_NONE)
+    {
+        Index = Names.Add(Name);
+    }
+    uint32 PackedIndex = static_cast<uint32>(Index);
+    SerializeIntPacked(PackedIndex);
+    return *this;
+}
+
+FSaveGNameTableReader::FSaveGNameTableReader(const TArray<uint8>& InBytes, const TArray<FName>& InNames) : FMemoryReader(InBytes), Names(InNames) {}
+
+FArchive& FSaveGNameTableReader::operator<<(FName& Name)
+{
+    uint32 PackedIndex = 0;
+    SerializeIntPacked(PackedIndex);
+    if (!Names.IsValidIndex(static_cast<int32>(PackedIndex)))
+    {
+        SetError();
+        Name = NAME_None;
+        return *this;
+    }
+    Name = Names[PackedIndex];
+    return *this;
+}
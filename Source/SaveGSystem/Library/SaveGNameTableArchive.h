@@ -0,0 +1,44 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+/**
+ * @class Memory writer that stores every FName as a packed index into a name table collected while writing.
+ * Property names and FName values of a tagged binary stream are written once per table instead of once per use.
+ */
+class SAVEGSYSTEM_API FSaveGNameTableWriter : public FMemoryWriter
+{
+public:
+    FSaveGNameTableWriter(TArray<uint8>& InBytes, TArray<FName>& InNames);
+
+    virtual FArchive& operator<<(FName& Name) override;
+    virtual FString GetArchiveName() const override { return TEXT("FSaveGNameTableWriter"); }
+
+private:
+    /** @private **/
+    TArray<FName>& Names;
+
+    /** @private **/
+    TMap<FName, int32> NameToIndex;
+};
+
+/**
+ * @class Memory reader that resolves packed name indices written by FSaveGNameTableWriter.
+ * An index outside of the table puts the archive into the error state.
+ */
+class SAVEGSYSTEM_API FSaveGNameTableReader : public FMemoryReader
+{
+public:
+    FSaveGNameTableReader(const TArray<uint8>& InBytes, const TArray<FName>& InNames);
+
+    virtual FArchive& operator<<(FName& Name) override;
+    virtual FString GetArchiveName() const override { return TEXT("FSaveGNameTableReader"); }
+
+private:
+    /** @private **/
+    const TArray<FName>& Names;
+};
@@ -0,0 +1,166 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SaveGPropertyPlan.h"
+#include "Misc/Crc.h"
+#include "SaveGSystem/Library/SaveGLibrary.h"
+
+namespace
+{
+FRWLock PlanCacheLock;
+TMap<TWeakObjectPtr<const UStruct>, FSaveGPropertyPlanRef> PlanCache;
+FDelegateHandle ReloadCompleteHandle;
+FDelegateHandle ObjectsReinstancedHandle;
+}  // namespace
+
+FSaveGPropertyPlan::FSaveGPropertyPlan(const UStruct* InStruct)
+{
+    if (!InStruct) return;
+
+    // Only classes filter by the flag, struct fields are always saved as a whole
+    const bool bOnlySaveGame = InStruct->IsA<UClass>();
+    for (TFieldIterator<FProperty> PropIt(InStruct); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        if (!Property) continue;
+        if (bOnlySaveGame && !Property->HasAnyPropertyFlags(CPF_SaveGame)) continue;
+
+        FPropertyPlanEntry_SaveGSystem Entry;
+        Entry.Type = USaveGLibrary::GetPropertyType(Property);
+        if (Entry.Type == EPropertyType_SaveGSystem::None) continue;
+
+        Entry.Property = Property;
+        Entry.Name = Property->GetFName();
+        Entry.Offset = Property->GetOffset_ForInternal();
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            Entry.InnerType = USaveGLibrary::GetPropertyType(ArrayProperty->Inner);
+        }
+        else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+        {
+            Entry.InnerType = USaveGLibrary::GetPropertyType(MapProperty->KeyProp);
+            Entry.ValueType = USaveGLibrary::GetPropertyType(MapProperty->ValueProp);
+        }
+        else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            Entry.InnerType = USaveGLibrary::GetPropertyType(SetProperty->ElementProp);
+        }
+        NameToIndex.Add(Entry.Name, Entries.Add(Entry));
+    }
+
+    // Creating a class default object is only safe on the game thread, a plan built on a worker takes it once it exists
+    if (const UClass* Class = Cast<UClass>(InStruct))
+    {
+        DefaultsClass = Class;
+        DefaultObject = Class->GetDefaultObject(IsInGameThread());
+    }
+
+    // A struct is copied as raw memory only when every byte of it belongs to a bulk-copyable field
+    if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(InStruct))
+    {
+        StructDefaults = MakeUnique<FStructOnScope>(ScriptStruct);
+
+        bool bAllFieldsBulkCopyable = true;
+        int32 FieldsSize = 0;
+        LayoutHash = GetTypeHash(ScriptStruct->GetStructureSize());
+        for (TFieldIterator<FProperty> PropIt(ScriptStruct); PropIt; ++PropIt)
+        {
+            const FProperty* Property = *PropIt;
+            bAllFieldsBulkCopyable &= IsBulkCopyable(Property);
+            FieldsSize += Property->GetSize();
+            // The name text is hashed, the hash of an FName depends on the order names were registered in this run
+            LayoutHash = HashCombine(LayoutHash, FCrc::StrCrc32(*Property->GetName()));
+            LayoutHash = HashCombine(LayoutHash, GetTypeHash(static_cast<uint8>(USaveGLibrary::GetPropertyType(Property))));
+            LayoutHash = HashCombine(LayoutHash, GetTypeHash(Property->GetOffset_ForInternal()));
+            LayoutHash = HashCombine(LayoutHash, GetLayoutHash(Property));
+        }
+        const bool bPlainOldData = (ScriptStruct->StructFlags & STRUCT_IsPlainOldData) != 0;
+        bBulkCopyable = bAllFieldsBulkCopyable && (bPlainOldData || FieldsSize == ScriptStruct->GetStructureSize());
+    }
+}
+
+FSaveGPropertyPlanRef FSaveGPropertyPlan::Get(const UStruct* Struct)
+{
+    const TWeakObjectPtr<const UStruct> Key(Struct);
+    {
+        FReadScopeLock ReadLock(PlanCacheLock);
+        if (const FSaveGPropertyPlanRef* Plan = PlanCache.Find(Key))
+        {
+            return *Plan;
+        }
+    }
+
+    FSaveGPropertyPlanRef NewPlan = MakeShared<const FSaveGPropertyPlan, ESPMode::ThreadSafe>(Struct);
+    FWriteScopeLock WriteLock(PlanCacheLock);
+    if (const FSaveGPropertyPlanRef* Plan = PlanCache.Find(Key))
+    {
+        return *Plan;
+    }
+    if (Struct)
+    {
+        PlanCache.Add(Key, NewPlan);
+    }
+    return NewPlan;
+}
+
+void FSaveGPropertyPlan::Invalidate()
+{
+    FWriteScopeLock WriteLock(PlanCacheLock);
+    PlanCache.Empty();
+}
+
+void FSaveGPropertyPlan::StartupCache()
+{
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason) { Invalidate(); });
+    ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const FCoreUObjectDelegates::FReplacementObjectMap&) { Invalidate(); });
+}
+
+void FSaveGPropertyPlan::ShutdownCache()
+{
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+    Invalidate();
+}
+
+const FPropertyPlanEntry_SaveGSystem* FSaveGPropertyPlan::FindEntry(const FName& Name) const
+{
+    const int32* Index = NameToIndex.Find(Name);
+    return Index ? &Entries[*Index] : nullptr;
+}
+
+const void* FSaveGPropertyPlan::GetDefaults() const
+{
+    if (StructDefaults.IsValid()) return StructDefaults->GetStructMemory();
+
+    const UObject* Defaults = DefaultObject.load(std::memory_order_acquire);
+    if (!Defaults && DefaultsClass)
+    {
+        Defaults = DefaultsClass->GetDefaultObject(IsInGameThread());
+        DefaultObject.store(Defaults, std::memory_order_release);
+    }
+    return Defaults;
+}
+
+bool FSaveGPropertyPlan::IsBulkCopyable(const FProperty* Property)
+{
+    if (!Property) return false;
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        // Bitfields share their byte with other fields
+        return BoolProperty->IsNativeBool();
+    }
+    if (Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>()) return true;
+    if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        return StructProperty->Struct && Get(StructProperty->Struct)->IsBulkCopyable();
+    }
+    return false;
+}
+
+uint32 FSaveGPropertyPlan::GetLayoutHash(const FProperty* Property)
+{
+    if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        return StructProperty->Struct ? Get(StructProperty->Struct)->GetLayoutHash() : 0;
+    }
+    return 0;
+}
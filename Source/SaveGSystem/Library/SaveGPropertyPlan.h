@@ -0,0 +1,94 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveGSystem/Data/SaveGSystemDataTypes.h"
+#include "UObject/StructOnScope.h"
+#include <atomic>
+
+/** @struct Compiled description of a single property of a serialization plan **/
+struct FPropertyPlanEntry_SaveGSystem
+{
+    FProperty* Property{nullptr};
+    FName Name{NAME_None};
+    int32 Offset{0};
+    EPropertyType_SaveGSystem Type{EPropertyType_SaveGSystem::None};
+
+    /** Type of the array element, the map key or the set element **/
+    EPropertyType_SaveGSystem InnerType{EPropertyType_SaveGSystem::None};
+
+    /** Type of the map value **/
+    EPropertyType_SaveGSystem ValueType{EPropertyType_SaveGSystem::None};
+};
+
+using FSaveGPropertyPlanRef = TSharedRef<const class FSaveGPropertyPlan, ESPMode::ThreadSafe>;
+
+/**
+ * @class Flat list of the properties of a class or struct that take part in saving.
+ * Classes contribute their CPF_SaveGame properties, structs contribute all of their properties.
+ * Plans are built once per UStruct, cached and dropped on hot reload or Blueprint reinstancing.
+ */
+class SAVEGSYSTEM_API FSaveGPropertyPlan
+{
+public:
+    explicit FSaveGPropertyPlan(const UStruct* InStruct);
+
+    /** @public Get the cached plan of a class or struct, building it on first use. Thread-safe **/
+    static FSaveGPropertyPlanRef Get(const UStruct* Struct);
+
+    /** @public Drop all cached plans **/
+    static void Invalidate();
+
+    /** @public Subscribe the cache to hot reload and reinstancing events **/
+    static void StartupCache();
+
+    /** @public Unsubscribe the cache from engine events and drop all cached plans **/
+    static void ShutdownCache();
+
+    /** @public All entries in declaration order **/
+    const TArray<FPropertyPlanEntry_SaveGSystem>& GetEntries() const { return Entries; }
+
+    /** @public Find an entry by property name **/
+    const FPropertyPlanEntry_SaveGSystem* FindEntry(const FName& Name) const;
+
+    /**
+     * @public Default values of the properties: the class default object or a default constructed struct. Can be nullptr.
+     * The class default object is only ever created on the game thread, a worker gets nullptr while it does not exist yet
+     */
+    const void* GetDefaults() const;
+
+    /** @public Check if the struct has only numeric, bool and enum fields and no hidden members, so it can be copied as raw memory **/
+    bool IsBulkCopyable() const { return bBulkCopyable; }
+
+    /** @public Hash of the field names, types and offsets of the struct, used to validate raw memory copies **/
+    uint32 GetLayoutHash() const { return LayoutHash; }
+
+    /** @public Check if values of the property can be copied as raw memory: numerics, bools, enums and bulk-copyable structs **/
+    static bool IsBulkCopyable(const FProperty* Property);
+
+    /** @public Hash of the memory layout of the property values, zero for anything but structs **/
+    static uint32 GetLayoutHash(const FProperty* Property);
+
+private:
+    /** @private **/
+    TArray<FPropertyPlanEntry_SaveGSystem> Entries;
+
+    /** @private **/
+    TMap<FName, int32> NameToIndex;
+
+    /** @private **/
+    bool bBulkCopyable{false};
+
+    /** @private **/
+    uint32 LayoutHash{0};
+
+    /** @private Class whose default object is taken, set for class plans only **/
+    const UClass* DefaultsClass{nullptr};
+
+    /** @private Class default objects are kept alive by their class, the plan is dropped on reinstancing. Taken later if the plan is built before it exists **/
+    mutable std::atomic<const UObject*> DefaultObject{nullptr};
+
+    /** @private **/
+    TUniquePtr<FStructOnScope> StructDefaults;
+};
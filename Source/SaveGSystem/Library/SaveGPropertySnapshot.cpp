@@ -0,0 +1,28 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SaveGPropertySnapshot.h"
+
+FSaveGPropertySnapshot::FSaveGPropertySnapshot(const UObject* Object) : Plan(FSaveGPropertyPlan::Get(Object ? Object->GetClass() : nullptr))
+{
+    if (!Object) return;
+
+    const UClass* Class = Object->GetClass();
+    Data = static_cast<uint8*>(FMemory::Malloc(Class->GetPropertiesSize(), Class->GetMinAlignment()));
+    FMemory::Memzero(Data, Class->GetPropertiesSize());
+    for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan->GetEntries())
+    {
+        Entry.Property->InitializeValue_InContainer(Data);
+        Entry.Property->CopyCompleteValue_InContainer(Data, Object);
+    }
+}
+
+FSaveGPropertySnapshot::~FSaveGPropertySnapshot()
+{
+    if (!Data) return;
+
+    for (const FPropertyPlanEntry_SaveGSystem& Entry : Plan->GetEntries())
+    {
+        Entry.Property->DestroyValue_InContainer(Data);
+    }
+    FMemory::Free(Data);
+}
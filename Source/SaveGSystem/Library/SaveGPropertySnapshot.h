@@ -0,0 +1,38 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveGSystem/Library/SaveGPropertyPlan.h"
+
+/**
+ * @class Copy of the SaveGame property values of an object, taken on the game thread (or on the thread that owns the object) so that they can be encoded on a worker thread.
+ * The buffer is laid out like the object itself, but only the properties of the plan are constructed in it.
+ */
+class SAVEGSYSTEM_API FSaveGPropertySnapshot
+{
+public:
+    explicit FSaveGPropertySnapshot(const UObject* Object);
+    ~FSaveGPropertySnapshot();
+
+    FSaveGPropertySnapshot(const FSaveGPropertySnapshot&) = delete;
+    FSaveGPropertySnapshot& operator=(const FSaveGPropertySnapshot&) = delete;
+
+    /** @public Plan of the class the snapshot was taken from **/
+    const FSaveGPropertyPlan& GetPlan() const { return *Plan; }
+
+    /** @public Memory of the copied values, usable as the container of the plan entries. Can be nullptr **/
+    const void* GetData() const { return Data; }
+
+    /** @public Check if the snapshot holds the values of an object **/
+    bool IsValid() const { return Data != nullptr; }
+
+private:
+    /** @private **/
+    FSaveGPropertyPlanRef Plan;
+
+    /** @private **/
+    uint8* Data{nullptr};
+};
+
+using FSaveGPropertySnapshotRef = TSharedRef<const FSaveGPropertySnapshot, ESPMode::ThreadSafe>;
@@ -9,4 +9,58 @@ bool USaveGSettings::IsEnableDataJSONFileStatic()
         return SaveGSettings->IsEnableDataJSONFile();
     }
     return false;
-}
\ No newline at end of file
+}
+
+ESerializeFormat_SaveGSystem USaveGSettings::GetSerializeFormatStatic()
+{
+    if (const USaveGSettings* SaveGSettings = GetDefault<USaveGSettings>())
+    {
+        return SaveGSettings->GetSerializeFormat();
+    }
+    return ESerializeFormat_SaveGSystem::Binary;
+}
+
+bool USaveGSettings::IsSkipDefaultValuesStatic()
+{
+    if (const USaveGSettings* SaveGSettings = GetDefault<USaveGSettings>())
+    {
+        return SaveGSettings->IsSkipDefaultValues();
+    }
+    return false;
+}
+
+int32 USaveGSettings::GetMaxConcurrentActionsStatic()
+{
+    if (const USaveGSettings* SaveGSettings = GetDefault<USaveGSettings>())
+    {
+        return SaveGSettings->GetMaxConcurrentActions();
+    }
+    return 1;
+}
+
+float USaveGSettings::GetFrameBudgetMsStatic()
+{
+    if (const USaveGSettings* SaveGSettings = GetDefault<USaveGSettings>())
+    {
+        return SaveGSettings->GetFrameBudgetMs();
+    }
+    return 2.0f;
+}
+
+ECompressionCodec_SaveGSystem USaveGSettings::GetCompressionCodecStatic()
+{
+    if (const USaveGSettings* SaveGSettings = GetDefault<USaveGSettings>())
+    {
+        return SaveGSettings->GetCompressionCodec();
+    }
+    return ECompressionCodec_SaveGSystem::Zlib;
+}
+
+ECompressionLevel_SaveGSystem USaveGSettings::GetCompressionLevelStatic()
+{
+    if (const USaveGSettings* SaveGSettings = GetDefault<USaveGSettings>())
+    {
+        return SaveGSettings->GetCompressionLevel();
+    }
+    return ECompressionLevel_SaveGSystem::Normal;
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "SaveGSystem/Data/SaveGSystemDataTypes.h"
 #include "SaveGSettings.generated.h"
 
 /**
@@ -22,8 +23,74 @@ public:
     /** @public Getting status data saving to a JSON file **/
     bool IsEnableDataJSONFile() const { return bEnableSaveDataJSONFile; }
 
+    /** @public Getting the format in which object properties are serialized **/
+    UFUNCTION(BlueprintCallable, Category = "General Settings")
+    static ESerializeFormat_SaveGSystem GetSerializeFormatStatic();
+
+    /** @public Getting the format in which object properties are serialized **/
+    ESerializeFormat_SaveGSystem GetSerializeFormat() const { return SerializeFormat; }
+
+    /** @public Getting status skipping properties that equal their class or struct defaults **/
+    UFUNCTION(BlueprintCallable, Category = "General Settings")
+    static bool IsSkipDefaultValuesStatic();
+
+    /** @public Getting status skipping properties that equal their class or struct defaults **/
+    bool IsSkipDefaultValues() const { return bSkipDefaultValues; }
+
+    /** @public Getting the number of save/load actions that may be in process at the same time **/
+    UFUNCTION(BlueprintCallable, Category = "General Settings")
+    static int32 GetMaxConcurrentActionsStatic();
+
+    /** @public Getting the number of save/load actions that may be in process at the same time **/
+    int32 GetMaxConcurrentActions() const { return FMath::Max(MaxConcurrentActions, 1); }
+
+    /** @public Getting the time per frame in milliseconds spent on starting queued save/load requests **/
+    UFUNCTION(BlueprintCallable, Category = "General Settings")
+    static float GetFrameBudgetMsStatic();
+
+    /** @public Getting the time per frame in milliseconds spent on starting queued save/load requests **/
+    float GetFrameBudgetMs() const { return FMath::Max(FrameBudgetMs, 0.0f); }
+
+    /** @public Getting the codec that compresses save payloads **/
+    UFUNCTION(BlueprintCallable, Category = "General Settings")
+    static ECompressionCodec_SaveGSystem GetCompressionCodecStatic();
+
+    /** @public Getting the codec that compresses save payloads **/
+    ECompressionCodec_SaveGSystem GetCompressionCodec() const { return CompressionCodec; }
+
+    /** @public Getting the compression level of save payloads **/
+    UFUNCTION(BlueprintCallable, Category = "General Settings")
+    static ECompressionLevel_SaveGSystem GetCompressionLevelStatic();
+
+    /** @public Getting the compression level of save payloads **/
+    ECompressionLevel_SaveGSystem GetCompressionLevel() const { return CompressionLevel; }
+
 private:
     /** @private Enable data saving to a JSON file **/
     UPROPERTY(Config, EditAnywhere, Category = "General Settings")
     bool bEnableSaveDataJSONFile{false};
+
+    /** @private Format in which object properties are serialized. JSON is kept for debugging **/
+    UPROPERTY(Config, EditAnywhere, Category = "General Settings")
+    ESerializeFormat_SaveGSystem SerializeFormat{ESerializeFormat_SaveGSystem::Binary};
+
+    /** @private Do not write binary properties that equal the class default object or the struct defaults, they are restored from the defaults on load **/
+    UPROPERTY(Config, EditAnywhere, Category = "General Settings")
+    bool bSkipDefaultValues{false};
+
+    /** @private Number of save/load actions that may be in process at the same time. Actions of the same tag always run one after another **/
+    UPROPERTY(Config, EditAnywhere, Category = "General Settings", meta = (ClampMin = "1"))
+    int32 MaxConcurrentActions{16};
+
+    /** @private Time per frame in milliseconds spent on starting queued save/load requests. At least one request is started every frame **/
+    UPROPERTY(Config, EditAnywhere, Category = "General Settings", meta = (ClampMin = "0.0", Units = "ms"))
+    float FrameBudgetMs{2.0f};
+
+    /** @private Codec that compresses save payloads. The codec is stored in the file, so files of any codec can be loaded **/
+    UPROPERTY(Config, EditAnywhere, Category = "General Settings")
+    ECompressionCodec_SaveGSystem CompressionCodec{ECompressionCodec_SaveGSystem::Zlib};
+
+    /** @private Compression level of save payloads. Only affects saving **/
+    UPROPERTY(Config, EditAnywhere, Category = "General Settings")
+    ECompressionLevel_SaveGSystem CompressionLevel{ECompressionLevel_SaveGSystem::Normal};
 };
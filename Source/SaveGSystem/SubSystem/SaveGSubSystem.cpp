@@ -1,9 +1,182 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "SaveGSubSystem.h"
+#include "Algo/AnyOf.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "SaveGSystem/Interface/SaveGInterface.h"
 #include "SaveGSystem/Library/SaveGLibrary.h"
+#include "SaveGSystem/Library/SaveGPropertySnapshot.h"
 #include "SaveGSystem/Settings/SaveGSettings.h"
-#include "SaveGSystem/Task/UpdateSaveDataAsyncTask.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+namespace
+{
+uint8 PeekJsonByte(const TArray<uint8>& Data, int32 Pos)
+{
+    return Data.IsValidIndex(Pos) ? Data[Pos] : 0;
+}
+
+void SkipJsonWhitespace(const TArray<uint8>& Data, int32& Pos)
+{
+    while (Data.IsValidIndex(Pos) && (Data[Pos] == ' ' || Data[Pos] == '\t' || Data[Pos] == '\r' || Data[Pos] == '\n'))
+    {
+        ++Pos;
+    }
+}
+
+// Appends a quoted and escaped JSON string encoded in UTF-8
+void WriteJsonString(TArray<uint8>& OutData, const FString& Value)
+{
+    FString Escaped;
+    Escaped.Reserve(Value.Len() + 2);
+    Escaped += TEXT('"');
+    for (const TCHAR Char : Value)
+    {
+        if (Char == TEXT('"') || Char == TEXT('\\'))
+        {
+            Escaped += TEXT('\\');
+            Escaped += Char;
+        }
+        else if (Char < 0x20)
+        {
+            Escaped += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+        }
+        else
+        {
+            Escaped += Char;
+        }
+    }
+    Escaped += TEXT('"');
+
+    FTCHARToUTF8 Converter(*Escaped, Escaped.Len());
+    OutData.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+}
+
+// Reads the four hex digits of a \u escape at Pos and moves Pos past them
+bool ReadJsonHexCodeUnit(const TArray<uint8>& Data, int32& Pos, uint32& OutCodeUnit)
+{
+    if (!Data.IsValidIndex(Pos + 3)) return false;
+    const FString Hex(4, reinterpret_cast<const ANSICHAR*>(Data.GetData() + Pos));
+    OutCodeUnit = FParse::HexNumber(*Hex);
+    Pos += 4;
+    return true;
+}
+
+// Appends a Unicode code point whatever the width of TCHAR is, a lone surrogate is kept as it is
+void AppendJsonCodePoint(FString& OutValue, uint32 CodePoint)
+{
+    if (CodePoint < 0x10000 || sizeof(TCHAR) == 4)
+    {
+        OutValue += static_cast<TCHAR>(CodePoint);
+        return;
+    }
+    CodePoint -= 0x10000;
+    OutValue += static_cast<TCHAR>(0xD800 + (CodePoint >> 10));
+    OutValue += static_cast<TCHAR>(0xDC00 + (CodePoint & 0x3FF));
+}
+
+// Reads the quoted JSON string starting at Pos and moves Pos past the closing quote
+bool ReadJsonString(const TArray<uint8>& Data, int32& Pos, FString& OutValue)
+{
+    if (PeekJsonByte(Data, Pos) != '"') return false;
+    ++Pos;
+
+    OutValue.Reset();
+    int32 RunStart = Pos;
+    auto FlushRun = [&]()
+    {
+        if (Pos > RunStart)
+        {
+            FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data.GetData() + RunStart), Pos - RunStart);
+            OutValue.AppendChars(Converter.Get(), Converter.Length());
+        }
+    };
+    while (Data.IsValidIndex(Pos))
+    {
+        const uint8 Char = Data[Pos];
+        if (Char == '"')
+        {
+            FlushRun();
+            ++Pos;
+            return true;
+        }
+        if (Char != '\\')
+        {
+            ++Pos;
+            continue;
+        }
+
+        FlushRun();
+        const uint8 Escape = PeekJsonByte(Data, Pos + 1);
+        Pos += 2;
+        switch (Escape)
+        {
+            case 'b': OutValue += TEXT('\b'); break;
+            case 'f': OutValue += TEXT('\f'); break;
+            case 'n': OutValue += TEXT('\n'); break;
+            case 'r': OutValue += TEXT('\r'); break;
+            case 't': OutValue += TEXT('\t'); break;
+            case 'u':
+            {
+                uint32 CodePoint = 0;
+                if (!ReadJsonHexCodeUnit(Data, Pos, CodePoint)) return false;
+
+                // A character outside the Basic Multilingual Plane is escaped as a surrogate pair
+                uint32 LowSurrogate = 0;
+                if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && PeekJsonByte(Data, Pos) == '\\' && PeekJsonByte(Data, Pos + 1) == 'u')
+                {
+                    int32 LowPos = Pos + 2;
+                    if (ReadJsonHexCodeUnit(Data, LowPos, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+                    {
+                        CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+                        Pos = LowPos;
+                    }
+                }
+                AppendJsonCodePoint(OutValue, CodePoint);
+                break;
+            }
+            case 0: return false;
+            default: OutValue += static_cast<TCHAR>(Escape); break;
+        }
+        RunStart = Pos;
+    }
+    return false;
+}
+
+// Moves Pos past the JSON object or array starting at Pos, stepping over strings
+bool SkipJsonContainerValue(const TArray<uint8>& Data, int32& Pos)
+{
+    int32 Depth = 0;
+    bool bInString = false;
+    for (; Data.IsValidIndex(Pos); ++Pos)
+    {
+        const uint8 Char = Data[Pos];
+        if (bInString)
+        {
+            if (Char == '\\') ++Pos;
+            else if (Char == '"') bInString = false;
+            continue;
+        }
+        if (Char == '"') bInString = true;
+        else if (Char == '{' || Char == '[') ++Depth;
+        else if ((Char == '}' || Char == ']') && --Depth == 0)
+        {
+            ++Pos;
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
 
 #pragma region Actions
 
@@ -17,43 +190,145 @@ USaveGSubSystem* USaveGSubSystem::Get(const UGameInstance* GameInstance)
     return GameInstance != nullptr ? GameInstance->GetSubsystem<USaveGSubSystem>() : nullptr;
 }
 
-void USaveGSubSystem::UpdateSaveData(FString Tag, UObject* SavedObject)
+void USaveGSubSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
-    if (CLOG_SAVE_G_SYSTEM(SavedObject == nullptr, "Saved Object is nullptr")) return;
-    if (CLOG_SAVE_G_SYSTEM(Tag.IsEmpty(), "Tag is empty")) return;
+    Super::Initialize(Collection);
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickRequestActionData));
+}
 
-    FInitDataAsyncTask_SaveGSystem NewDataTask;
-    NewDataTask.Action = ETaskAction_SaveGSystem::Save;
-    NewDataTask.Object = SavedObject;
-    NewDataTask.Tag = Tag;
-    RequestActionData.Add(NewDataTask);
-    if (UGameInstance* GameInstance = GetGameInstance())
+void USaveGSubSystem::Deinitialize()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+    // Nobody is going to carry out the pending requests any more
+    for (auto& [Tag, PendingRequests] : RequestActionData)
     {
-        GameInstance->GetTimerManager().SetTimerForNextTick(this, &ThisClass::NextRequestActionData);
+        for (FInitDataAsyncTask_SaveGSystem& Request : PendingRequests)
+        {
+            Request.ResolvePromises(false);
+        }
     }
+    RequestActionData.Empty();
+    ReadyTags.Empty();
+    Super::Deinitialize();
+}
+
+void USaveGSubSystem::UpdateSaveData(FString Tag, UObject* SavedObject)
+{
+    UpdateSaveDataAsync(Tag, SavedObject);
+}
+
+TFuture<bool> USaveGSubSystem::UpdateSaveDataAsync(const FString& Tag, UObject* SavedObject)
+{
+    if (CLOG_SAVE_G_SYSTEM(SavedObject == nullptr, "Saved Object is nullptr")) return MakeFulfilledPromise<bool>(false).GetFuture();
+    if (CLOG_SAVE_G_SYSTEM(Tag.IsEmpty(), "Tag is empty")) return MakeFulfilledPromise<bool>(false).GetFuture();
+
+    FInitDataAsyncTask_SaveGSystem Request = MakeSaveRequest(Tag, SavedObject);
+    TFuture<bool> Future = Request.Promises.Add_GetRef(MakeShared<TPromise<bool>, ESPMode::ThreadSafe>())->GetFuture();
+    AddRequestActionData(MoveTemp(Request));
+    return Future;
+}
+
+void USaveGSubSystem::SubmitUpdateSaveData(const FString& Tag, UObject* SavedObject)
+{
+    FInitDataAsyncTask_SaveGSystem Request;
+    Request.Action = ETaskAction_SaveGSystem::Save;
+    Request.Tag = Tag;
+    Request.Object = SavedObject;
+    SubmittedRequests.Enqueue(MoveTemp(Request));
+}
+
+void USaveGSubSystem::SubmitLoadSaveData(const FString& Tag, UObject* SavedObject)
+{
+    FInitDataAsyncTask_SaveGSystem Request;
+    Request.Action = ETaskAction_SaveGSystem::Load;
+    Request.Tag = Tag;
+    Request.Object = SavedObject;
+    SubmittedRequests.Enqueue(MoveTemp(Request));
+}
+
+void USaveGSubSystem::SubmitSnapshot(const FString& Tag, FSaveGPropertySnapshotRef Snapshot)
+{
+    FInitDataAsyncTask_SaveGSystem Request;
+    Request.Action = ETaskAction_SaveGSystem::Save;
+    Request.Tag = Tag;
+    Request.Snapshot = Snapshot;
+    SubmittedRequests.Enqueue(MoveTemp(Request));
+}
+
+bool USaveGSubSystem::SaveWorld(const UObject* WorldContextObject)
+{
+    return StartWorldAction(ETaskAction_SaveGSystem::Save, WorldContextObject);
+}
+
+bool USaveGSubSystem::LoadWorld(const UObject* WorldContextObject)
+{
+    return StartWorldAction(ETaskAction_SaveGSystem::Load, WorldContextObject);
+}
+
+float USaveGSubSystem::GetFrameBudgetMs() const
+{
+    return FrameBudgetMs > 0.0f ? FrameBudgetMs : USaveGSettings::GetFrameBudgetMsStatic();
 }
 
 bool USaveGSubSystem::IsHaveTag(FString Tag) const
 {
     if (CLOG_SAVE_G_SYSTEM(Tag.IsEmpty(), "Tag is empty")) return false;
-    return SaveGData.Contains(Tag);
+    return FindSaveGData(Tag) != nullptr;
 }
 
 void USaveGSubSystem::LoadSaveData(FString Tag, UObject* SavedObject)
+{
+    LoadSaveDataAsync(Tag, SavedObject);
+}
+
+TFuture<bool> USaveGSubSystem::LoadSaveDataAsync(const FString& Tag, UObject* SavedObject)
+{
+    if (CLOG_SAVE_G_SYSTEM(SavedObject == nullptr, "Saved Object is nullptr")) return MakeFulfilledPromise<bool>(false).GetFuture();
+    if (CLOG_SAVE_G_SYSTEM(Tag.IsEmpty(), "Tag is empty")) return MakeFulfilledPromise<bool>(false).GetFuture();
+    // A save of the tag that is still queued or in process will provide the data by the time the load starts
+    const TDeque<FInitDataAsyncTask_SaveGSystem>* PendingRequests = RequestActionData.Find(Tag);
+    const bool bPendingSave = TagsInProcess.Contains(Tag) ||
+                              (PendingRequests != nullptr &&
+                                  Algo::AnyOf(*PendingRequests, [](const FInitDataAsyncTask_SaveGSystem& Data) { return Data.Action == ETaskAction_SaveGSystem::Save; }));
+    if (CLOG_SAVE_G_SYSTEM(FindSaveGData(Tag) == nullptr && !bPendingSave, "SaveGData do not contains Tag - %s", *Tag)) return MakeFulfilledPromise<bool>(false).GetFuture();
+
+    FInitDataAsyncTask_SaveGSystem Request = MakeLoadRequest(Tag, SavedObject);
+    TFuture<bool> Future = Request.Promises.Add_GetRef(MakeShared<TPromise<bool>, ESPMode::ThreadSafe>())->GetFuture();
+    AddRequestActionData(MoveTemp(Request));
+    return Future;
+}
+
+void USaveGSubSystem::UpdateSaveDataImmediate(FString Tag, UObject* SavedObject)
 {
     if (CLOG_SAVE_G_SYSTEM(SavedObject == nullptr, "Saved Object is nullptr")) return;
     if (CLOG_SAVE_G_SYSTEM(Tag.IsEmpty(), "Tag is empty")) return;
-    if (CLOG_SAVE_G_SYSTEM(!SaveGData.Contains(Tag), "SaveGData do not contains Tag - %s", *Tag)) return;
 
-    FInitDataAsyncTask_SaveGSystem NewDataTask;
-    NewDataTask.Action = ETaskAction_SaveGSystem::Load;
-    NewDataTask.Object = SavedObject;
-    NewDataTask.Tag = Tag;
-    NewDataTask.JsonSaveData = SaveGData[Tag];
-    RequestActionData.Add(NewDataTask);
-    if (UGameInstance* GameInstance = GetGameInstance())
+    FInitDataAsyncTask_SaveGSystem InitData = MakeSaveRequest(Tag, SavedObject);
+    ProcessSaveRequestImmediate(InitData);
+}
+
+void USaveGSubSystem::LoadSaveDataImmediate(FString Tag, UObject* SavedObject)
+{
+    if (CLOG_SAVE_G_SYSTEM(SavedObject == nullptr, "Saved Object is nullptr")) return;
+    if (CLOG_SAVE_G_SYSTEM(Tag.IsEmpty(), "Tag is empty")) return;
+
+    ProcessLoadRequest(MakeLoadRequest(Tag, SavedObject));
+}
+
+void USaveGSubSystem::UpdateSaveDataImmediateBatch(const TMap<FString, UObject*>& SavedObjects)
+{
+    for (const auto& [Tag, SavedObject] : SavedObjects)
     {
-        GameInstance->GetTimerManager().SetTimerForNextTick(this, &ThisClass::NextRequestActionData);
+        UpdateSaveDataImmediate(Tag, SavedObject);
+    }
+}
+
+void USaveGSubSystem::LoadSaveDataImmediateBatch(const TMap<FString, UObject*>& SavedObjects)
+{
+    for (const auto& [Tag, SavedObject] : SavedObjects)
+    {
+        LoadSaveDataImmediate(Tag, SavedObject);
     }
 }
 
@@ -63,55 +338,125 @@ void USaveGSubSystem::SaveDataInFile(FString FileName)
     {
         FileName = GenerateSaveFileName();
     }
-    FileName = USaveGLibrary::ValidateFileName(FileName);
-    FString Directory = FPaths::ProjectSavedDir();
-    FString FilePath = Directory + "SaveGame/" + FileName + ".SaveG";
-    TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
-    for (auto& Pair : SaveGData)
+    FTagDataMap_SaveGSystem MergedData;
+    const FTagDataMap_SaveGSystem& Data = MergeTagData(*SaveGData, SaveGDataDelta, MergedData);
+    WriteSaveFile(Data, USaveGLibrary::ValidateFileName(FileName), IsBinaryContainerRequired(Data), USaveGSettings::IsEnableDataJSONFileStatic());
+}
+
+void USaveGSubSystem::LoadDataFromFile(const FString& FileName)
+{
+    if (CLOG_SAVE_G_SYSTEM(FileName.IsEmpty(), "File Name is empty")) return;
+
+    FTagDataMap_SaveGSystem LoadedData;
+    if (ReadSaveFile(FileName, LoadedData))
     {
-        JsonObject->SetStringField(Pair.Key, *Pair.Value);
+        ResetSaveGData(MoveTemp(LoadedData));
     }
-    FString JsonString = USaveGLibrary::ConvertJsonObjectToString(JsonObject);
-    LOG_SAVE_G_SYSTEM(Display, "Convert JSON | Count bytes: %i | Data: %s", JsonString.Len(), *JsonString);
+}
+
+bool USaveGSubSystem::LoadTagsFromFile(const FString& FileName, const TArray<FString>& Tags)
+{
+    if (CLOG_SAVE_G_SYSTEM(FileName.IsEmpty(), "File Name is empty")) return false;
 
-    if (USaveGSettings::IsEnableDataJSONFileStatic())
+    const TSet<FString> WantedTags(Tags);
+    FTagDataMap_SaveGSystem LoadedData;
+    if (!ReadSaveFile(FileName, LoadedData, &WantedTags)) return false;
+
+    for (const auto& Pair : LoadedData)
     {
-        FString FilePathJson = Directory + "SaveGame/" + FileName + ".json";
-        FFileHelper::SaveStringToFile(JsonString, *FilePathJson);
+        StoreSaveGData(Pair.Key, Pair.Value);
     }
+    return true;
+}
 
-    FString TrimStr = JsonString.TrimStartAndEnd();
-    TArray<uint8> ConvertByte = USaveGLibrary::ConvertStringToByte(TrimStr);
-    TArray<uint8> CompressData;
-    USaveGLibrary::CompressData(ConvertByte, CompressData);
-    LOG_SAVE_G_SYSTEM(Display, "Compress data | Count bytes: %i", CompressData.Num());
-
-    FFileHelper::SaveArrayToFile(CompressData, *FilePath);
+TArray<FString> USaveGSubSystem::GetSaveFileTags(const FString& FileName)
+{
+    TArray<FString> Tags;
+    if (!CLOG_SAVE_G_SYSTEM(FileName.IsEmpty(), "File Name is empty"))
+    {
+        ReadSaveFileTags(FileName, Tags);
+    }
+    return Tags;
 }
 
-void USaveGSubSystem::LoadDataFromFile(const FString& FileName)
+TFuture<bool> USaveGSubSystem::SaveDataInFileAsync(FString FileName)
 {
-    if (CLOG_SAVE_G_SYSTEM(FileName.IsEmpty(), "File Name is empty")) return;
+    if (FileName.IsEmpty())
+    {
+        FileName = GenerateSaveFileName();
+    }
+    FileName = USaveGLibrary::ValidateFileName(FileName);
 
-    FString Directory = FPaths::ProjectSavedDir();
-    FString FilePath = Directory + "SaveGame/" + FileName + ".SaveG";
-    TArray<uint8> CompressData;
-    FFileHelper::LoadFileToArray(CompressData, *FilePath);
+    // The writer shares the current tag map, saves that complete while the file is written go to the delta and to the next file.
+    // The delta is only non-empty here while another write still runs, the writer then applies a copy of it on its own thread
+    TSharedRef<TPromise<bool>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<bool>, ESPMode::ThreadSafe>();
+    TSharedPtr<const FTagDataMap_SaveGSystem, ESPMode::ThreadSafe> Data = SaveGData;
+    const bool bSaveJsonFile = USaveGSettings::IsEnableDataJSONFileStatic();
+    ++FileActionsInProcess;
+    TWeakObjectPtr<USaveGSubSystem> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [WeakThis, Promise, FileName, Data, Delta = SaveGDataDelta, bSaveJsonFile]() mutable
+        {
+            FTagDataMap_SaveGSystem MergedData;
+            const FTagDataMap_SaveGSystem& WrittenData = MergeTagData(*Data, Delta, MergedData);
+            const bool bSuccess = WriteSaveFile(WrittenData, FileName, IsBinaryContainerRequired(WrittenData), bSaveJsonFile);
 
-    TArray<uint8> DecompressData;
-    USaveGLibrary::DecompressData(CompressData, DecompressData);
-    FString JsonString = USaveGLibrary::ConvertByteToString(DecompressData);
-    LOG_SAVE_G_SYSTEM(Display, "Convert JSON | Count bytes: %i | Data: %s", JsonString.Len(), *JsonString);
+            // Released before the game thread is told, so the delta can be merged right away
+            Data.Reset();
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Promise, FileName, bSuccess]()
+                {
+                    if (USaveGSubSystem* SaveGSubSystem = WeakThis.Get())
+                    {
+                        --SaveGSubSystem->FileActionsInProcess;
+                        SaveGSubSystem->MergeSaveGDataDelta();
+                        SaveGSubSystem->OnFileSaveComplete.Broadcast(FileName, bSuccess);
+                    }
+                    Promise->SetValue(bSuccess);
+                });
+        });
+    return Promise->GetFuture();
+}
 
-    FString TrimStr = JsonString.TrimStartAndEnd();
-    TSharedPtr<FJsonObject> JsonObject = USaveGLibrary::ConvertStringToJsonObject(TrimStr);
-    if (CLOG_SAVE_G_SYSTEM(!JsonObject.IsValid(), "JsonObject is not valid reader")) return;
+TFuture<bool> USaveGSubSystem::LoadDataFromFileAsync(const FString& FileName)
+{
+    if (CLOG_SAVE_G_SYSTEM(FileName.IsEmpty(), "File Name is empty")) return MakeFulfilledPromise<bool>(false).GetFuture();
 
-    SaveGData.Empty();
-    for (auto& Pair : JsonObject->Values)
-    {
-        SaveGData.Add(Pair.Key, Pair.Value->AsString());
-    }
+    // Saves whose data is taken after this point get a later generation and are kept over the tags of the file
+    TSharedRef<TPromise<bool>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<bool>, ESPMode::ThreadSafe>();
+    const uint64 StartGeneration = SaveGeneration;
+    ++FileActionsInProcess;
+    TWeakObjectPtr<USaveGSubSystem> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [WeakThis, Promise, FileName, StartGeneration]()
+        {
+            FTagDataMap_SaveGSystem LoadedData;
+            const bool bSuccess = ReadSaveFile(FileName, LoadedData);
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Promise, FileName, StartGeneration, bSuccess, LoadedData = MoveTemp(LoadedData)]() mutable
+                {
+                    if (USaveGSubSystem* SaveGSubSystem = WeakThis.Get())
+                    {
+                        --SaveGSubSystem->FileActionsInProcess;
+                        if (bSuccess)
+                        {
+                            for (const auto& [Tag, Generation] : SaveGSubSystem->StoredGenerations)
+                            {
+                                const FTagDataRef_SaveGSystem* CurrentData = SaveGSubSystem->FindSaveGData(Tag);
+                                if (Generation > StartGeneration && CurrentData)
+                                {
+                                    LOG_SAVE_G_SYSTEM(Display, "Kept Saved Data: Tag - [%s] | Saved while the file %s was loaded", *Tag, *FileName);
+                                    LoadedData.Add(Tag, *CurrentData);
+                                }
+                            }
+                            SaveGSubSystem->ResetSaveGData(MoveTemp(LoadedData));
+                        }
+                        SaveGSubSystem->OnFileLoadComplete.Broadcast(FileName, bSuccess);
+                    }
+                    Promise->SetValue(bSuccess);
+                });
+        });
+    return Promise->GetFuture();
 }
 
 TArray<FString> USaveGSubSystem::GetAllSaveFiles()
@@ -133,53 +478,927 @@ FString USaveGSubSystem::GenerateSaveFileName()
     return FString::Printf(TEXT("SaveGame_%s"), *FDateTime::Now().ToString());
 }
 
-void USaveGSubSystem::NextRequestActionData()
+bool USaveGSubSystem::IsBinaryContainer(const TArray<uint8>& Data)
+{
+    if (Data.Num() < sizeof(uint32)) return false;
+
+    FMemoryReader Reader(Data);
+    uint32 Magic = 0;
+    Reader << Magic;
+    return Magic == SaveGSystemSpace::BinaryFileMagic;
+}
+
+bool USaveGSubSystem::IsIndexedContainer(FArchive& Ar)
 {
-    if (ActionDataAsyncTask.Get() != nullptr) return;
-    RequestActionData.RemoveAll([](const FInitDataAsyncTask_SaveGSystem& Data) { return !Data.IsValid(); });
-    if (RequestActionData.Num() == 0) return;
-    if (!RequestActionData.IsValidIndex(0)) return;
+    if (Ar.TotalSize() < static_cast<int64>(sizeof(uint32))) return false;
+
+    uint32 Magic = 0;
+    Ar << Magic;
+    Ar.Seek(0);
+    return Magic == SaveGSystemSpace::IndexedFileMagic;
+}
+
+bool USaveGSubSystem::IsBinaryContainerRequired(const FTagDataMap_SaveGSystem& InSaveGData)
+{
+    return USaveGSettings::GetSerializeFormatStatic() == ESerializeFormat_SaveGSystem::Binary ||
+           Algo::AnyOf(InSaveGData, [](const auto& Pair) { return Pair.Value->Format == ESerializeFormat_SaveGSystem::Binary; });
+}
+
+FString USaveGSubSystem::GetSaveFilePath(const FString& FileName, const TCHAR* Extension)
+{
+    return FPaths::ProjectSavedDir() + "SaveGame/" + FileName + Extension;
+}
 
-    FInitDataAsyncTask_SaveGSystem InitData = RequestActionData[0];
-    if (auto* Node = UUpdateSaveDataAsyncTask::Create(InitData))
+bool USaveGSubSystem::WriteSaveFile(const FTagDataMap_SaveGSystem& InSaveGData, const FString& FileName, bool bBinaryContainer, bool bSaveJsonFile)
+{
+    TArray<uint8> FileData;
+    const double StartTime = FPlatformTime::Seconds();
+    if (bBinaryContainer)
+    {
+        // The blocks of an indexed file are compressed one by one, the file itself is written as it is
+        if (CLOG_SAVE_G_SYSTEM(!SerializeIndexedContainer(InSaveGData, FileData), "Failed to encode save file %s", *FileName)) return false;
+        LOG_SAVE_G_SYSTEM(Display, "Convert Indexed | Count bytes: %i | Time: %.3f ms", FileData.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+    else
     {
-        Node->GetCompleteTaskSignature().AddDynamic(this, &ThisClass::RegisterCompleteActionDataAsyncTask);
-        Node->Activate();
-        ActionDataAsyncTask = Node;
+        TArray<uint8> ConvertByte;
+        SerializeJsonContainer(InSaveGData, ConvertByte);
+        LOG_SAVE_G_SYSTEM(Display, "Convert JSON | Count bytes: %i | Time: %.3f ms", ConvertByte.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+        if (bSaveJsonFile)
+        {
+            FFileHelper::SaveArrayToFile(ConvertByte, *GetSaveFilePath(FileName, TEXT(".json")));
+        }
+
+        if (CLOG_SAVE_G_SYSTEM(!USaveGLibrary::CompressData(ConvertByte, FileData), "Failed to compress save file %s", *FileName)) return false;
+        LOG_SAVE_G_SYSTEM(Display, "Compress data | Count bytes: %i", FileData.Num());
     }
-    RequestActionData.RemoveAt(0);
+
+    return !CLOG_SAVE_G_SYSTEM(!FFileHelper::SaveArrayToFile(FileData, *GetSaveFilePath(FileName, TEXT(".SaveG"))), "Failed to write save file %s", *FileName);
 }
 
-void USaveGSubSystem::RegisterCompleteActionDataAsyncTask(const FString& Tag, UObject* SavedObject)
+bool USaveGSubSystem::ReadSaveFile(const FString& FileName, FTagDataMap_SaveGSystem& OutSaveGData, const TSet<FString>* Tags, bool bAllowMapping)
 {
-    if (ActionDataAsyncTask.Get() == nullptr) return;
-    ActionDataAsyncTask->GetCompleteTaskSignature().RemoveDynamic(this, &ThisClass::RegisterCompleteActionDataAsyncTask);
+    const FString FilePath = GetSaveFilePath(FileName, TEXT(".SaveG"));
 
-    FInitDataAsyncTask_SaveGSystem InitData = ActionDataAsyncTask->GetInitData();
-    if (InitData.Action == ETaskAction_SaveGSystem::Save)
+    // Indexed files are decoded straight from the mapping instead of a copy in memory, platforms without mapping read them through an archive.
+    // Files of older versions still make one copy of the compressed data for the Zlib proxy.
+    TUniquePtr<IMappedFileHandle> MappedHandle;
+    TUniquePtr<IMappedFileRegion> MappedRegion = bAllowMapping ? MapSaveFile(FilePath, MappedHandle) : nullptr;
+    if (MappedRegion)
     {
-        if (SaveGData.Contains(Tag))
+        const TConstArrayView<uint8> MappedData(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize()));
+        FMemoryReaderView Reader(MappedData);
+        return ReadSaveFileData(FileName, Reader, MappedData, OutSaveGData, Tags);
+    }
+
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+    if (CLOG_SAVE_G_SYSTEM(!Reader, "Failed to read save file %s", *FileName)) return false;
+
+    return ReadSaveFileData(FileName, *Reader, {}, OutSaveGData, Tags);
+}
+
+TUniquePtr<IMappedFileRegion> USaveGSubSystem::MapSaveFile(const FString& FilePath, TUniquePtr<IMappedFileHandle>& OutMappedHandle)
+{
+    FOpenMappedResult MappedResult = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*FilePath);
+    OutMappedHandle = MappedResult.HasValue() ? MappedResult.StealValue() : nullptr;
+    const int64 FileSize = OutMappedHandle ? OutMappedHandle->GetFileSize() : 0;
+    return TUniquePtr<IMappedFileRegion>(FileSize > 0 && FileSize <= MAX_int32 ? OutMappedHandle->MapRegion(0, FileSize) : nullptr);
+}
+
+bool USaveGSubSystem::ReadSaveFileData(
+    const FString& FileName, FArchive& Ar, TConstArrayView<uint8> MappedData, FTagDataMap_SaveGSystem& OutSaveGData, const TSet<FString>* Tags)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    if (IsIndexedContainer(Ar))
+    {
+        const bool bSuccess = DeserializeIndexedContainer(Ar, MappedData, Tags, OutSaveGData);
+        LOG_SAVE_G_SYSTEM(Display, "Convert Indexed | Count tags: %i | Time: %.3f ms", OutSaveGData.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        return bSuccess;
+    }
+
+    // Files of older versions and JSON containers are a single compressed payload that is decoded as a whole
+    TArray<uint8> FileBuffer;
+    TConstArrayView<uint8> CompressData = MappedData;
+    if (CompressData.IsEmpty())
+    {
+        FileBuffer.SetNumUninitialized(Ar.TotalSize());
+        Ar.Serialize(FileBuffer.GetData(), FileBuffer.Num());
+        if (CLOG_SAVE_G_SYSTEM(Ar.IsError(), "Failed to read save file %s", *FileName)) return false;
+        CompressData = FileBuffer;
+    }
+
+    TArray<uint8> DecompressData;
+    if (CLOG_SAVE_G_SYSTEM(!USaveGLibrary::DecompressDataParallel(CompressData, DecompressData), "Failed to decompress save file %s", *FileName)) return false;
+
+    bool bSuccess = false;
+    if (IsBinaryContainer(DecompressData))
+    {
+        bSuccess = DeserializeBinaryContainer(DecompressData, OutSaveGData);
+        LOG_SAVE_G_SYSTEM(Display, "Convert Binary | Count bytes: %i | Time: %.3f ms", DecompressData.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+    else
+    {
+        bSuccess = DeserializeJsonContainer(DecompressData, OutSaveGData);
+        LOG_SAVE_G_SYSTEM(Display, "Convert JSON | Count bytes: %i | Time: %.3f ms", DecompressData.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+
+    if (bSuccess && Tags)
+    {
+        for (auto It = OutSaveGData.CreateIterator(); It; ++It)
+        {
+            if (!Tags->Contains(It.Key()))
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+    return bSuccess;
+}
+
+bool USaveGSubSystem::ReadSaveFileTags(const FString& FileName, TArray<FString>& OutTags)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetSaveFilePath(FileName, TEXT(".SaveG"))));
+    if (CLOG_SAVE_G_SYSTEM(!Reader, "Failed to read save file %s", *FileName)) return false;
+
+    if (IsIndexedContainer(*Reader))
+    {
+        TArray<FSaveFileBlock_SaveGSystem> Blocks;
+        TArray<FSaveFileTocEntry_SaveGSystem> Entries;
+        if (!ReadIndexedToc(*Reader, Blocks, Entries)) return false;
+
+        OutTags.Reset(Entries.Num());
+        for (const FSaveFileTocEntry_SaveGSystem& Entry : Entries)
+        {
+            OutTags.Add(Entry.Tag);
+        }
+        return true;
+    }
+
+    // Files without a table of contents have to be decoded to know their tags
+    Reader.Reset();
+    FTagDataMap_SaveGSystem LoadedData;
+    if (!ReadSaveFile(FileName, LoadedData)) return false;
+
+    LoadedData.GetKeys(OutTags);
+    return true;
+}
+
+bool USaveGSubSystem::SerializeIndexedContainer(const FTagDataMap_SaveGSystem& InSaveGData, TArray<uint8>& OutData)
+{
+    // Small tags are grouped so that a block still compresses well, every tag is listed with the block holding it
+    TArray<FTagDataMap_SaveGSystem> Groups;
+    TArray<FSaveFileTocEntry_SaveGSystem> Entries;
+    Entries.Reserve(InSaveGData.Num());
+    int64 GroupSize = SaveGSystemSpace::IndexedBlockSize;
+    for (const auto& Pair : InSaveGData)
+    {
+        if (GroupSize >= SaveGSystemSpace::IndexedBlockSize)
         {
-            SaveGData[Tag] = InitData.JsonSaveData;
-            LOG_SAVE_G_SYSTEM(Display, "Updated Saved Data: Tag - [%s] | Data - [%s]", *Tag, *InitData.JsonSaveData);
+            Groups.AddDefaulted();
+            GroupSize = 0;
+        }
+        Groups.Last().Add(Pair.Key, Pair.Value);
+        GroupSize += Pair.Value->Data.Num();
+
+        FSaveFileTocEntry_SaveGSystem& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Tag = Pair.Key;
+        Entry.BlockIndex = Groups.Num() - 1;
+    }
+
+    // Every block is a complete binary container with its own name table, so it decodes without the rest of the file
+    const ECompressionCodec_SaveGSystem Codec = USaveGSettings::GetCompressionCodecStatic();
+    const ECompressionLevel_SaveGSystem Level = USaveGSettings::GetCompressionLevelStatic();
+    TArray<TArray<uint8>> BlockData;
+    BlockData.SetNum(Groups.Num());
+    std::atomic<bool> bFailed{false};
+    ParallelFor(Groups.Num(),
+        [&](int32 BlockIndex)
+        {
+            TArray<uint8> ContainerData;
+            SerializeBinaryContainer(Groups[BlockIndex], ContainerData);
+            if (!USaveGLibrary::CompressDataParallel(ContainerData, BlockData[BlockIndex], Codec, Level))
+            {
+                bFailed = true;
+            }
+        });
+    if (bFailed) return false;
+
+    TArray<FSaveFileBlock_SaveGSystem> Blocks;
+    Blocks.SetNum(BlockData.Num());
+    int64 Offset = 0;
+    for (int32 BlockIndex = 0; BlockIndex < BlockData.Num(); ++BlockIndex)
+    {
+        FSaveFileBlock_SaveGSystem& Block = Blocks[BlockIndex];
+        Block.Offset = Offset;
+        Block.Length = BlockData[BlockIndex].Num();
+        Block.Checksum = FCrc::MemCrc32(BlockData[BlockIndex].GetData(), Block.Length);
+        Block.Codec = static_cast<uint8>(Codec);
+        Offset += Block.Length;
+    }
+
+    OutData.Reset();
+    FMemoryWriter Writer(OutData);
+    uint32 Magic = SaveGSystemSpace::IndexedFileMagic;
+    uint16 Version = SaveGSystemSpace::IndexedFileVersion;
+    Writer << Magic;
+    Writer << Version;
+    Writer << Blocks;
+    Writer << Entries;
+    for (const TArray<uint8>& Data : BlockData)
+    {
+        OutData.Append(Data);
+    }
+    return true;
+}
+
+bool USaveGSubSystem::ReadIndexedToc(FArchive& Ar, TArray<FSaveFileBlock_SaveGSystem>& OutBlocks, TArray<FSaveFileTocEntry_SaveGSystem>& OutEntries)
+{
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    Ar << Magic;
+    Ar << Version;
+    if (CLOG_SAVE_G_SYSTEM(Magic != SaveGSystemSpace::IndexedFileMagic, "Indexed save file has a wrong magic number")) return false;
+    if (CLOG_SAVE_G_SYSTEM(Ar.IsError() || Version == 0 || Version > SaveGSystemSpace::IndexedFileVersion, "Unsupported indexed save file version: %i", Version)) return false;
+
+    Ar << OutBlocks;
+    Ar << OutEntries;
+    if (CLOG_SAVE_G_SYSTEM(Ar.IsError(), "Indexed save file is corrupted")) return false;
+
+    const int64 BlocksSize = Ar.TotalSize() - Ar.Tell();
+    for (const FSaveFileBlock_SaveGSystem& Block : OutBlocks)
+    {
+        if (CLOG_SAVE_G_SYSTEM(Block.Offset < 0 || Block.Length <= 0 || Block.Offset + Block.Length > BlocksSize, "Indexed save file has an invalid block")) return false;
+    }
+    for (const FSaveFileTocEntry_SaveGSystem& Entry : OutEntries)
+    {
+        if (CLOG_SAVE_G_SYSTEM(!OutBlocks.IsValidIndex(Entry.BlockIndex), "Indexed save file has an invalid block index")) return false;
+    }
+    return true;
+}
+
+bool USaveGSubSystem::DeserializeIndexedContainer(FArchive& Ar, TConstArrayView<uint8> MappedData, const TSet<FString>* Tags, FTagDataMap_SaveGSystem& OutSaveGData)
+{
+    TArray<FSaveFileBlock_SaveGSystem> Blocks;
+    TArray<FSaveFileTocEntry_SaveGSystem> Entries;
+    if (!ReadIndexedToc(Ar, Blocks, Entries)) return false;
+
+    TBitArray<> WantedBlocks(false, Blocks.Num());
+    for (const FSaveFileTocEntry_SaveGSystem& Entry : Entries)
+    {
+        if (!Tags || Tags->Contains(Entry.Tag))
+        {
+            WantedBlocks[Entry.BlockIndex] = true;
+        }
+    }
+    TArray<int32> BlockIndices;
+    for (TConstSetBitIterator<> It(WantedBlocks); It; ++It)
+    {
+        BlockIndices.Add(It.GetIndex());
+    }
+
+    // Only the blocks holding a wanted tag are touched, a mapped file is not copied at all
+    const int64 BlocksStart = Ar.Tell();
+    TArray<TConstArrayView<uint8>> BlockData;
+    TArray<TArray<uint8>> BlockBuffers;
+    BlockData.Reserve(BlockIndices.Num());
+    BlockBuffers.SetNum(MappedData.IsEmpty() ? BlockIndices.Num() : 0);
+    for (int32 Index = 0; Index < BlockIndices.Num(); ++Index)
+    {
+        const FSaveFileBlock_SaveGSystem& Block = Blocks[BlockIndices[Index]];
+        if (!MappedData.IsEmpty())
+        {
+            BlockData.Add(MappedData.Slice(static_cast<int32>(BlocksStart + Block.Offset), Block.Length));
+            continue;
+        }
+
+        TArray<uint8>& Buffer = BlockBuffers[Index];
+        Buffer.SetNumUninitialized(Block.Length);
+        Ar.Seek(BlocksStart + Block.Offset);
+        Ar.Serialize(Buffer.GetData(), Block.Length);
+        if (CLOG_SAVE_G_SYSTEM(Ar.IsError(), "Failed to read block %i of the indexed save file", BlockIndices[Index])) return false;
+        BlockData.Add(Buffer);
+    }
+
+    TArray<FTagDataMap_SaveGSystem> BlockTags;
+    BlockTags.SetNum(BlockData.Num());
+    std::atomic<bool> bFailed{false};
+    ParallelFor(BlockData.Num(),
+        [&](int32 Index)
+        {
+            const FSaveFileBlock_SaveGSystem& Block = Blocks[BlockIndices[Index]];
+            if (CLOG_SAVE_G_SYSTEM(FCrc::MemCrc32(BlockData[Index].GetData(), BlockData[Index].Num()) != Block.Checksum,
+                    "Block %i of the indexed save file is corrupted", BlockIndices[Index]))
+            {
+                bFailed = true;
+                return;
+            }
+            if (CLOG_SAVE_G_SYSTEM(BlockData[Index].Num() <= SaveGSystemSpace::CompressedCodecOffset || BlockData[Index][SaveGSystemSpace::CompressedCodecOffset] != Block.Codec,
+                    "Block %i of the indexed save file has a different codec than its table of contents entry", BlockIndices[Index]))
+            {
+                bFailed = true;
+                return;
+            }
+
+            TArray<uint8> ContainerData;
+            if (!USaveGLibrary::DecompressDataParallel(BlockData[Index], ContainerData) || !DeserializeBinaryContainer(ContainerData, BlockTags[Index]))
+            {
+                bFailed = true;
+            }
+        });
+    if (CLOG_SAVE_G_SYSTEM(bFailed, "Failed to decode the indexed save file")) return false;
+
+    FTagDataMap_SaveGSystem LoadedData;
+    LoadedData.Reserve(Tags ? Tags->Num() : Entries.Num());
+    for (const FTagDataMap_SaveGSystem& TagsOfBlock : BlockTags)
+    {
+        for (const auto& Pair : TagsOfBlock)
+        {
+            if (!Tags || Tags->Contains(Pair.Key))
+            {
+                LoadedData.Add(Pair.Key, Pair.Value);
+            }
+        }
+    }
+    OutSaveGData = MoveTemp(LoadedData);
+    return true;
+}
+
+void USaveGSubSystem::SerializeBinaryContainer(const FTagDataMap_SaveGSystem& InSaveGData, TArray<uint8>& OutData)
+{
+    // Merge the name tables of all tags, every tag keeps only the global indices of its own names
+    TArray<FName> GlobalNames;
+    TMap<FName, int32> GlobalNameToIndex;
+    TArray<TArray<int32>> TagNameIndices;
+    TagNameIndices.Reserve(InSaveGData.Num());
+    for (const auto& Pair : InSaveGData)
+    {
+        TArray<int32>& Indices = TagNameIndices.AddDefaulted_GetRef();
+        Indices.Reserve(Pair.Value->Names.Num());
+        for (const FName& Name : Pair.Value->Names)
+        {
+            int32& Index = GlobalNameToIndex.FindOrAdd(Name, INDEX_NONE);
+            if (Index == INDEX_NONE)
+            {
+                Index = GlobalNames.Add(Name);
+            }
+            Indices.Add(Index);
+        }
+    }
+
+    FMemoryWriter Writer(OutData);
+    uint32 Magic = SaveGSystemSpace::BinaryFileMagic;
+    uint16 Version = SaveGSystemSpace::BinaryFileVersion;
+    int32 NumNames = GlobalNames.Num();
+    Writer << Magic;
+    Writer << Version;
+    Writer << NumNames;
+    for (const FName& Name : GlobalNames)
+    {
+        FString NameString = Name.ToString();
+        Writer << NameString;
+    }
+
+    int32 Num = InSaveGData.Num();
+    Writer << Num;
+    int32 TagIndex = 0;
+    for (const auto& Pair : InSaveGData)
+    {
+        FString Tag = Pair.Key;
+        uint8 Format = static_cast<uint8>(Pair.Value->Format);
+        Writer << Tag;
+        Writer << Format;
+        Writer << TagNameIndices[TagIndex++];
+        // Archives take their operands by reference, a saving writer leaves the array untouched
+        Writer << const_cast<TArray<uint8>&>(Pair.Value->Data);
+    }
+}
+
+bool USaveGSubSystem::DeserializeBinaryContainer(const TArray<uint8>& Data, FTagDataMap_SaveGSystem& OutSaveGData)
+{
+    FMemoryReader Reader(Data);
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    Reader << Magic;
+    Reader << Version;
+    if (CLOG_SAVE_G_SYSTEM(Magic != SaveGSystemSpace::BinaryFileMagic, "Binary container has a wrong magic number")) return false;
+    if (CLOG_SAVE_G_SYSTEM(Version == 0 || Version > SaveGSystemSpace::BinaryFileVersion, "Unsupported binary container version: %i", Version)) return false;
+
+    // Every name is turned into an FName once for the whole file, containers of the first version have no name table
+    TArray<FName> GlobalNames;
+    if (Version >= 2)
+    {
+        int32 NumNames = 0;
+        Reader << NumNames;
+        if (CLOG_SAVE_G_SYSTEM(NumNames < 0 || NumNames > Data.Num(), "Binary container is corrupted")) return false;
+
+        GlobalNames.Reserve(NumNames);
+        for (int32 Index = 0; Index < NumNames && !Reader.IsError(); ++Index)
+        {
+            FString NameString;
+            Reader << NameString;
+            GlobalNames.Add(FName(*NameString));
+        }
+    }
+
+    int32 Num = 0;
+    Reader << Num;
+    if (CLOG_SAVE_G_SYSTEM(Num < 0 || Num > Data.Num(), "Binary container is corrupted")) return false;
+
+    FTagDataMap_SaveGSystem LoadedData;
+    LoadedData.Reserve(Num);
+    for (int32 Index = 0; Index < Num && !Reader.IsError(); ++Index)
+    {
+        FString Tag;
+        uint8 Format = 0;
+        TArray<int32> NameIndices;
+        FTagData_SaveGSystem TagData;
+        Reader << Tag;
+        Reader << Format;
+        if (Version >= 2)
+        {
+            Reader << NameIndices;
+        }
+        Reader << TagData.Data;
+        TagData.Format = static_cast<ESerializeFormat_SaveGSystem>(Format);
+
+        TagData.Names.Reserve(NameIndices.Num());
+        for (const int32 NameIndex : NameIndices)
+        {
+            if (CLOG_SAVE_G_SYSTEM(!GlobalNames.IsValidIndex(NameIndex), "Binary container has an invalid name index")) return false;
+            TagData.Names.Add(GlobalNames[NameIndex]);
+        }
+        LoadedData.Add(MoveTemp(Tag), MakeShared<const FTagData_SaveGSystem, ESPMode::ThreadSafe>(MoveTemp(TagData)));
+    }
+    if (CLOG_SAVE_G_SYSTEM(Reader.IsError(), "Binary container is corrupted")) return false;
+
+    OutSaveGData = MoveTemp(LoadedData);
+    return true;
+}
+
+void USaveGSubSystem::SerializeJsonContainer(const FTagDataMap_SaveGSystem& InSaveGData, TArray<uint8>& OutData)
+{
+    // Tag payloads are already JSON objects, they are copied in as they are instead of being escaped into strings
+    OutData.Add('{');
+    bool bFirst = true;
+    for (const auto& Pair : InSaveGData)
+    {
+        if (!bFirst) OutData.Add(',');
+        bFirst = false;
+
+        WriteJsonString(OutData, Pair.Key);
+        OutData.Add(':');
+        if (Pair.Value->Data.IsEmpty())
+        {
+            OutData.Add('{');
+            OutData.Add('}');
         }
         else
         {
-            SaveGData.Add(Tag, InitData.JsonSaveData);
-            LOG_SAVE_G_SYSTEM(Display, "Create Saved Data: Tag - [%s] | Data - [%s]", *Tag, *InitData.JsonSaveData);
+            OutData.Append(Pair.Value->Data);
+        }
+    }
+    OutData.Add('}');
+}
+
+bool USaveGSubSystem::DeserializeJsonContainer(const TArray<uint8>& Data, FTagDataMap_SaveGSystem& OutSaveGData)
+{
+    int32 Pos = 0;
+    SkipJsonWhitespace(Data, Pos);
+    if (CLOG_SAVE_G_SYSTEM(PeekJsonByte(Data, Pos) != '{', "JSON container is not valid")) return false;
+    ++Pos;
+
+    FTagDataMap_SaveGSystem LoadedData;
+    SkipJsonWhitespace(Data, Pos);
+    if (PeekJsonByte(Data, Pos) == '}')
+    {
+        OutSaveGData.Empty();
+        return true;
+    }
+
+    while (true)
+    {
+        FString Tag;
+        SkipJsonWhitespace(Data, Pos);
+        if (CLOG_SAVE_G_SYSTEM(!ReadJsonString(Data, Pos, Tag), "JSON container is corrupted at byte %i", Pos)) return false;
+        SkipJsonWhitespace(Data, Pos);
+        if (CLOG_SAVE_G_SYSTEM(PeekJsonByte(Data, Pos) != ':', "JSON container is corrupted at byte %i", Pos)) return false;
+        ++Pos;
+        SkipJsonWhitespace(Data, Pos);
+
+        // Nested objects are sliced out as they are, files from older versions hold every tag as an escaped string
+        FTagData_SaveGSystem TagData;
+        TagData.Format = ESerializeFormat_SaveGSystem::Json;
+        const int32 ValueStart = Pos;
+        if (PeekJsonByte(Data, Pos) == '{')
+        {
+            if (CLOG_SAVE_G_SYSTEM(!SkipJsonContainerValue(Data, Pos), "JSON container is corrupted at byte %i", ValueStart)) return false;
+            TagData.Data.Append(Data.GetData() + ValueStart, Pos - ValueStart);
+        }
+        else
+        {
+            FString LegacyValue;
+            if (CLOG_SAVE_G_SYSTEM(!ReadJsonString(Data, Pos, LegacyValue), "JSON container is corrupted at byte %i", ValueStart)) return false;
+            TagData.Data = USaveGLibrary::ConvertStringToByte(LegacyValue);
+        }
+        LoadedData.Add(MoveTemp(Tag), MakeShared<const FTagData_SaveGSystem, ESPMode::ThreadSafe>(MoveTemp(TagData)));
+
+        SkipJsonWhitespace(Data, Pos);
+        const uint8 Separator = PeekJsonByte(Data, Pos++);
+        if (Separator == '}') break;
+        if (CLOG_SAVE_G_SYSTEM(Separator != ',', "JSON container is corrupted at byte %i", Pos - 1)) return false;
+    }
+
+    OutSaveGData = MoveTemp(LoadedData);
+    return true;
+}
+
+const FTagDataRef_SaveGSystem* USaveGSubSystem::FindSaveGData(const FString& Tag) const
+{
+    if (const FTagDataRef_SaveGSystem* DeltaData = SaveGDataDelta.Find(Tag))
+    {
+        return DeltaData;
+    }
+    return SaveGData->Find(Tag);
+}
+
+void USaveGSubSystem::StoreSaveGData(const FString& Tag, const FTagDataRef_SaveGSystem& Data)
+{
+    // Only the game thread hands out references, so a unique map cannot be picked up by a writer while it is changed
+    if (SaveGData.IsUnique())
+    {
+        MergeSaveGDataDelta();
+        SaveGData->Add(Tag, Data);
+        return;
+    }
+    SaveGDataDelta.Add(Tag, Data);
+}
+
+void USaveGSubSystem::ResetSaveGData(FTagDataMap_SaveGSystem&& Data)
+{
+    SaveGData = MakeShared<FTagDataMap_SaveGSystem, ESPMode::ThreadSafe>(MoveTemp(Data));
+    SaveGDataDelta.Empty();
+}
+
+void USaveGSubSystem::MergeSaveGDataDelta()
+{
+    if (SaveGDataDelta.IsEmpty() || !SaveGData.IsUnique()) return;
+
+    SaveGData->Append(MoveTemp(SaveGDataDelta));
+    SaveGDataDelta.Empty();
+}
+
+const FTagDataMap_SaveGSystem& USaveGSubSystem::MergeTagData(const FTagDataMap_SaveGSystem& Base, const FTagDataMap_SaveGSystem& Delta, FTagDataMap_SaveGSystem& OutMerged)
+{
+    if (Delta.IsEmpty()) return Base;
+
+    OutMerged = Base;
+    OutMerged.Append(Delta);
+    return OutMerged;
+}
+
+FInitDataAsyncTask_SaveGSystem USaveGSubSystem::MakeSaveRequest(const FString& Tag, UObject* SavedObject)
+{
+    FInitDataAsyncTask_SaveGSystem NewDataTask;
+    NewDataTask.Action = ETaskAction_SaveGSystem::Save;
+    NewDataTask.Object = SavedObject;
+    NewDataTask.Tag = Tag;
+    NewDataTask.SaveData.Format = USaveGSettings::GetSerializeFormatStatic();
+    NewDataTask.SaveData.bSkipDefaultValues = USaveGSettings::IsSkipDefaultValuesStatic();
+    return NewDataTask;
+}
+
+FInitDataAsyncTask_SaveGSystem USaveGSubSystem::MakeLoadRequest(const FString& Tag, UObject* SavedObject)
+{
+    FInitDataAsyncTask_SaveGSystem NewDataTask;
+    NewDataTask.Action = ETaskAction_SaveGSystem::Load;
+    NewDataTask.Object = SavedObject;
+    NewDataTask.Tag = Tag;
+    return NewDataTask;
+}
+
+void USaveGSubSystem::AddRequestActionData(FInitDataAsyncTask_SaveGSystem&& Request)
+{
+    if (TDeque<FInitDataAsyncTask_SaveGSystem>* PendingRequests = RequestActionData.Find(Request.Tag))
+    {
+        // Latest save wins, a pending load still gets the data of the save made before it
+        if (Request.Action == ETaskAction_SaveGSystem::Save && !PendingRequests->IsEmpty() && PendingRequests->Last().Action == ETaskAction_SaveGSystem::Save)
+        {
+            Request.Promises.Append(MoveTemp(PendingRequests->Last().Promises));
+            PendingRequests->Last() = MoveTemp(Request);
+            return;
         }
-        OnActionSaveComplete.Broadcast(Tag, SavedObject);
+        PendingRequests->EmplaceLast(MoveTemp(Request));
+        return;
     }
-    else if (InitData.Action == ETaskAction_SaveGSystem::Load)
+
+    const FString Tag = Request.Tag;
+    RequestActionData.Add(Tag).EmplaceLast(MoveTemp(Request));
+    // A tag in process is made ready again when its action completes
+    if (!TagsInProcess.Contains(Tag))
     {
-        OnActionLoadComplete.Broadcast(Tag, SavedObject);
+        ReadyTags.PushLast(Tag);
+    }
+}
+
+bool USaveGSubSystem::TickRequestActionData(float DeltaTime)
+{
+    DrainSubmittedRequests();
+
+    const double EndTime = FPlatformTime::Seconds() + GetFrameBudgetMs() / 1000.0;
+    StartRequestActionData(EndTime);
+    TickWorldAction(EndTime);
+    return true;
+}
+
+void USaveGSubSystem::DrainSubmittedRequests()
+{
+    // Submissions go through the same checks as the game thread calls, only later
+    FInitDataAsyncTask_SaveGSystem Submitted;
+    while (SubmittedRequests.Dequeue(Submitted))
+    {
+        if (Submitted.Snapshot.IsValid())
+        {
+            if (CLOG_SAVE_G_SYSTEM(Submitted.Tag.IsEmpty(), "Tag is empty")) continue;
+            if (CLOG_SAVE_G_SYSTEM(!Submitted.Snapshot->IsValid(), "Snapshot is not valid")) continue;
+
+            // The producer took the data before it submitted the snapshot
+            FInitDataAsyncTask_SaveGSystem Request = MakeSaveRequest(Submitted.Tag, nullptr);
+            Request.Snapshot = MoveTemp(Submitted.Snapshot);
+            Request.Generation = ++SaveGeneration;
+            AddRequestActionData(MoveTemp(Request));
+        }
+        else if (Submitted.Action == ETaskAction_SaveGSystem::Save)
+        {
+            UpdateSaveData(Submitted.Tag, Submitted.GetObject());
+        }
+        else if (Submitted.Action == ETaskAction_SaveGSystem::Load)
+        {
+            LoadSaveData(Submitted.Tag, Submitted.GetObject());
+        }
     }
+}
+
+void USaveGSubSystem::StartRequestActionData(double EndTime)
+{
+    // Tags start in the order they became ready, the requests of one tag keep the order they were made in.
+    // At least one request is started every frame, the rest only while the budget lasts.
+    const int32 MaxConcurrentActions = USaveGSettings::GetMaxConcurrentActionsStatic();
+    bool bStarted = false;
+    while (!ReadyTags.IsEmpty() && TagsInProcess.Num() < MaxConcurrentActions)
+    {
+        if (bStarted && FPlatformTime::Seconds() >= EndTime) break;
+
+        const FString Tag = ReadyTags.First();
+        ReadyTags.PopFirst();
+        TDeque<FInitDataAsyncTask_SaveGSystem>* PendingRequests = RequestActionData.Find(Tag);
+        if (PendingRequests == nullptr || PendingRequests->IsEmpty()) continue;
+
+        FInitDataAsyncTask_SaveGSystem InitData = MoveTemp(PendingRequests->First());
+        PendingRequests->PopFirst();
+
+        // Requests of objects destroyed while waiting are dropped
+        if (!InitData.IsValid())
+        {
+            InitData.ResolvePromises(false);
+        }
+        else if (InitData.Action == ETaskAction_SaveGSystem::Save)
+        {
+            ProcessSaveRequest(InitData);
+            bStarted = true;
+        }
+        else if (InitData.Action == ETaskAction_SaveGSystem::Load)
+        {
+            InitData.ResolvePromises(ProcessLoadRequest(InitData));
+            bStarted = true;
+        }
+
+        // The entry is kept while the request runs, so requests made from its delegates line up behind it
+        PendingRequests = RequestActionData.Find(Tag);
+        if (PendingRequests == nullptr) continue;
+        if (PendingRequests->IsEmpty())
+        {
+            RequestActionData.Remove(Tag);
+        }
+        else if (!TagsInProcess.Contains(Tag))
+        {
+            ReadyTags.PushLast(Tag);
+        }
+    }
+}
+
+bool USaveGSubSystem::StartWorldAction(ETaskAction_SaveGSystem Action, const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine != nullptr ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    if (CLOG_SAVE_G_SYSTEM(World == nullptr, "World is nullptr")) return false;
+    if (CLOG_SAVE_G_SYSTEM(WorldAction.IsActive(), "SaveWorld/LoadWorld is already in process")) return false;
+
+    WorldAction = FWorldAction_SaveGSystem();
+    WorldAction.Action = Action;
+    WorldAction.World = World;
+    return true;
+}
+
+void USaveGSubSystem::TickWorldAction(double EndTime)
+{
+    if (!WorldAction.IsActive()) return;
+
+    UWorld* World = WorldAction.World.Get();
+    if (CLOG_SAVE_G_SYSTEM(World == nullptr, "World of SaveWorld/LoadWorld is destroyed"))
+    {
+        FinishWorldAction();
+        return;
+    }
+
+    // Every step is a chunk of actors to gather or a single participant to process
+    for (bool bStepped = false; !bStepped || FPlatformTime::Seconds() < EndTime; bStepped = true)
+    {
+        if (!WorldAction.bGathered)
+        {
+            GatherWorldActionStep(World);
+            continue;
+        }
+        if (WorldAction.NumProcessed >= WorldAction.Participants.Num()) break;
+
+        // Participants run through the immediate paths, the budget bounds how many of them a frame takes
+        AActor* Actor = Cast<AActor>(WorldAction.Participants[WorldAction.NumProcessed++].Get());
+        if (!IsValid(Actor)) continue;
+        const FString Tag = Actor->GetName();
+        if (WorldAction.Action == ETaskAction_SaveGSystem::Save)
+        {
+            FInitDataAsyncTask_SaveGSystem InitData = MakeSaveRequest(Tag, Actor);
+            ProcessSaveRequestImmediate(InitData);
+        }
+        else if (FindSaveGData(Tag) != nullptr)
+        {
+            ProcessLoadRequest(MakeLoadRequest(Tag, Actor));
+        }
+    }
+
+    OnWorldActionProgress.Broadcast(WorldAction.GetProgress());
+    if (WorldAction.bGathered && WorldAction.NumProcessed >= WorldAction.Participants.Num())
+    {
+        FinishWorldAction();
+    }
+}
+
+void USaveGSubSystem::GatherWorldActionStep(UWorld* World)
+{
+    // Positions are checked again every step, levels streamed in or out between frames are picked up or skipped
+    const TArray<ULevel*>& Levels = World->GetLevels();
+    for (int32 Count = 0; Count < SaveGSystemSpace::WorldGatherChunkSize;)
+    {
+        if (!Levels.IsValidIndex(WorldAction.LevelIndex))
+        {
+            WorldAction.bGathered = true;
+            LOG_SAVE_G_SYSTEM(Display, "Gathered actors of the world: %i", WorldAction.Participants.Num());
+            return;
+        }
+
+        const ULevel* Level = Levels[WorldAction.LevelIndex];
+        if (Level == nullptr || !Level->Actors.IsValidIndex(WorldAction.ActorIndex))
+        {
+            ++WorldAction.LevelIndex;
+            WorldAction.ActorIndex = 0;
+            continue;
+        }
+
+        AActor* Actor = Level->Actors[WorldAction.ActorIndex++];
+        ++Count;
+        if (IsValid(Actor) && Actor->GetClass()->ImplementsInterface(USaveGInterface::StaticClass()))
+        {
+            WorldAction.Participants.Add(Actor);
+        }
+    }
+}
+
+void USaveGSubSystem::FinishWorldAction()
+{
+    const bool bSave = WorldAction.Action == ETaskAction_SaveGSystem::Save;
+    const int32 NumActors = WorldAction.Participants.Num();
+    WorldAction = FWorldAction_SaveGSystem();
+    OnWorldActionComplete.Broadcast(bSave, NumActors);
+}
+
+void USaveGSubSystem::ProcessSaveRequest(const FInitDataAsyncTask_SaveGSystem& InitData)
+{
+    // A submitted snapshot was already taken by its producer
+    TSharedPtr<const FSaveGPropertySnapshot, ESPMode::ThreadSafe> Snapshot = InitData.Snapshot;
+    if (!Snapshot.IsValid())
+    {
+        UObject* SavedObject = InitData.GetObject();
+        const bool bImplementsInterface = InitData.GetObjectClass()->ImplementsInterface(USaveGInterface::StaticClass());
+        if (bImplementsInterface)
+        {
+            ISaveGInterface::Execute_PreSave(SavedObject);
+        }
+
+        // Only the property values are copied on the game thread, the object is free to change once PostSave is called
+        Snapshot = MakeShared<const FSaveGPropertySnapshot, ESPMode::ThreadSafe>(SavedObject);
+
+        if (bImplementsInterface)
+        {
+            ISaveGInterface::Execute_PostSave(SavedObject);
+        }
+    }
+
+    TagsInProcess.Add(InitData.Tag);
+    const uint64 Generation = InitData.Generation != 0 ? InitData.Generation : ++SaveGeneration;
+    TWeakObjectPtr<USaveGSubSystem> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [WeakThis, Snapshot, Generation, Request = InitData]() mutable
+        {
+            USaveGLibrary::SerializeSnapshot(*Snapshot, Request.SaveData);
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Generation, Request = MoveTemp(Request)]() mutable
+                {
+                    USaveGSubSystem* SaveGSubSystem = WeakThis.Get();
+                    if (SaveGSubSystem == nullptr)
+                    {
+                        Request.ResolvePromises(false);
+                        return;
+                    }
+
+                    SaveGSubSystem->TagsInProcess.Remove(Request.Tag);
+                    if (SaveGSubSystem->RequestActionData.Contains(Request.Tag))
+                    {
+                        SaveGSubSystem->ReadyTags.PushLast(Request.Tag);
+                    }
+                    // An immediate save made while this one was encoded keeps its newer data
+                    Request.ResolvePromises(SaveGSubSystem->CompleteSaveRequest(Request.Tag, Request.GetObject(), MoveTemp(Request.SaveData), Generation));
+                });
+        });
+}
+
+void USaveGSubSystem::ProcessSaveRequestImmediate(FInitDataAsyncTask_SaveGSystem& InitData)
+{
+    UObject* SavedObject = InitData.GetObject();
+    const bool bImplementsInterface = InitData.GetObjectClass()->ImplementsInterface(USaveGInterface::StaticClass());
+    if (bImplementsInterface)
+    {
+        ISaveGInterface::Execute_PreSave(SavedObject);
+    }
+
+    // The object is serialized in place, there is no need for a snapshot when nothing runs in parallel
+    USaveGLibrary::SerializeObject(SavedObject, InitData.SaveData);
+
+    if (bImplementsInterface)
+    {
+        ISaveGInterface::Execute_PostSave(SavedObject);
+    }
+    CompleteSaveRequest(InitData.Tag, SavedObject, MoveTemp(InitData.SaveData), ++SaveGeneration);
+}
+
+bool USaveGSubSystem::CompleteSaveRequest(const FString& Tag, UObject* SavedObject, FTagData_SaveGSystem&& SaveData, uint64 Generation)
+{
+    uint64& StoredGeneration = StoredGenerations.FindOrAdd(Tag, 0);
+    if (Generation < StoredGeneration)
+    {
+        LOG_SAVE_G_SYSTEM(Display, "Dropped Saved Data: Tag - [%s] | Newer data is already stored", *Tag);
+        return false;
+    }
+    StoredGeneration = Generation;
+
+    const int32 NumBytes = SaveData.Data.Num();
+    const bool bExistingData = FindSaveGData(Tag) != nullptr;
+    StoreSaveGData(Tag, MakeShared<const FTagData_SaveGSystem, ESPMode::ThreadSafe>(MoveTemp(SaveData)));
+    if (bExistingData)
+    {
+        LOG_SAVE_G_SYSTEM(Display, "Updated Saved Data: Tag - [%s] | Count bytes - [%i]", *Tag, NumBytes);
+    }
+    else
+    {
+        LOG_SAVE_G_SYSTEM(Display, "Create Saved Data: Tag - [%s] | Count bytes - [%i]", *Tag, NumBytes);
+    }
+    OnActionSaveComplete.Broadcast(Tag, SavedObject);
+    return true;
+}
+
+bool USaveGSubSystem::ProcessLoadRequest(const FInitDataAsyncTask_SaveGSystem& InitData)
+{
+    // The data is taken only now, after every earlier save of the tag has finished
+    const FTagDataRef_SaveGSystem* FoundData = FindSaveGData(InitData.Tag);
+    if (CLOG_SAVE_G_SYSTEM(FoundData == nullptr, "SaveGData do not contains Tag - %s", *InitData.Tag)) return false;
+
+    // The reference keeps the data alive even if an interface hook saves the tag again
+    const FTagDataRef_SaveGSystem SaveData = *FoundData;
+    if (CLOG_SAVE_G_SYSTEM(SaveData->Data.IsEmpty(), "SaveData is empty")) return false;
+
+    UObject* SavedObject = InitData.GetObject();
+    const bool bImplementsInterface = InitData.GetObjectClass()->ImplementsInterface(USaveGInterface::StaticClass());
+    if (bImplementsInterface)
+    {
+        ISaveGInterface::Execute_PreLoad(SavedObject);
+    }
+
+    USaveGLibrary::DeserializeObject(SavedObject, *SaveData);
 
-    ActionDataAsyncTask.Reset();
-    if (UGameInstance* GameInstance = GetGameInstance())
+    if (bImplementsInterface)
     {
-        GameInstance->GetTimerManager().SetTimerForNextTick(this, &ThisClass::NextRequestActionData);
+        ISaveGInterface::Execute_PostLoad(SavedObject);
     }
+    OnActionLoadComplete.Broadcast(InitData.Tag, SavedObject);
+    return true;
 }
 
 #pragma endregion
\ No newline at end of file
@@ -3,14 +3,19 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Async/MappedFileHandle.h"
+#include "Containers/Deque.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
 #include "SaveGSystem/Data/SaveGSystemDataTypes.h"
+#include "SaveGSystem/Library/SaveGPropertySnapshot.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "SaveGSubSystem.generated.h"
 
-class UUpdateSaveDataAsyncTask;
-
 /**
  * @class Subsystem for managing save and load operations in the game.
+ * Queued requests are started from a core ticker within a per-frame time budget, the rest carries over to the next frame.
  */
 UCLASS()
 class SAVEGSYSTEM_API USaveGSubSystem : public UGameInstanceSubsystem
@@ -26,6 +31,12 @@ public:
     /** @public Get the SaveGSubSystem instance from the GameInstance **/
     static USaveGSubSystem* Get(const UGameInstance* GameInstance);
 
+    /** @public Register the ticker that pumps the request queue **/
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    /** @public Unregister the ticker that pumps the request queue **/
+    virtual void Deinitialize() override;
+
 #pragma endregion
 
 #pragma region Actions
@@ -35,6 +46,9 @@ public:
     UFUNCTION(BlueprintCallable)
     void UpdateSaveData(FString Tag, UObject* SavedObject);
 
+    /** @public Creates or updates data for all properties of an object. The future is set on the game thread once this request is done: true if the data is stored **/
+    TFuture<bool> UpdateSaveDataAsync(const FString& Tag, UObject* SavedObject);
+
     /** @public Checking for a tag with saved data **/
     UFUNCTION(BlueprintCallable)
     bool IsHaveTag(FString Tag) const;
@@ -43,6 +57,52 @@ public:
     UFUNCTION(BlueprintCallable)
     void LoadSaveData(FString Tag, UObject* SavedObject);
 
+    /** @public Loads all the saved data into an object. The future is set on the game thread once this request is done: true if the data is loaded **/
+    TFuture<bool> LoadSaveDataAsync(const FString& Tag, UObject* SavedObject);
+
+    /**
+     * @public Creates or updates data for all properties of an object right away. Queued and in-process requests of the tag are not waited for.
+     * A save of the tag whose data was taken before is dropped when it completes, so it never replaces this data.
+     */
+    UFUNCTION(BlueprintCallable)
+    void UpdateSaveDataImmediate(FString Tag, UObject* SavedObject);
+
+    /**
+     * @public Loads all the saved data into an object right away. Queued and in-process requests of the tag are not waited for:
+     * the data stored at the moment is loaded, a save of the tag still queued or encoded on a worker thread is not part of it.
+     */
+    UFUNCTION(BlueprintCallable)
+    void LoadSaveDataImmediate(FString Tag, UObject* SavedObject);
+
+    /** @public Creates or updates data of every object right away, e.g. on a loading screen or on shutdown **/
+    UFUNCTION(BlueprintCallable)
+    void UpdateSaveDataImmediateBatch(const TMap<FString, UObject*>& SavedObjects);
+
+    /** @public Loads the saved data into every object right away, e.g. on a loading screen **/
+    UFUNCTION(BlueprintCallable)
+    void LoadSaveDataImmediateBatch(const TMap<FString, UObject*>& SavedObjects);
+
+    /** @public Submit a save from any thread. It is queued like UpdateSaveData when the subsystem ticks next **/
+    void SubmitUpdateSaveData(const FString& Tag, UObject* SavedObject);
+
+    /** @public Submit a load from any thread. It is queued like LoadSaveData when the subsystem ticks next **/
+    void SubmitLoadSaveData(const FString& Tag, UObject* SavedObject);
+
+    /** @public Submit properties copied by the caller from any thread, e.g. by a worker that owns the object. The interface hooks are not called **/
+    void SubmitSnapshot(const FString& Tag, FSaveGPropertySnapshotRef Snapshot);
+
+    /** @public Save every actor of the world that implements the interface, spread over frames within the frame budget. The actor name is the tag **/
+    UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"))
+    bool SaveWorld(const UObject* WorldContextObject);
+
+    /** @public Load every actor of the world that implements the interface and has saved data, spread over frames within the frame budget **/
+    UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"))
+    bool LoadWorld(const UObject* WorldContextObject);
+
+    /** @public Check if a SaveWorld/LoadWorld is in process **/
+    UFUNCTION(BlueprintCallable)
+    bool IsWorldActionProcess() const { return WorldAction.IsActive(); }
+
     /** @public Save all data to a file **/
     UFUNCTION(BlueprintCallable)
     void SaveDataInFile(FString FileName = TEXT(""));
@@ -51,25 +111,156 @@ public:
     UFUNCTION(BlueprintCallable)
     void LoadDataFromFile(const FString& FileName);
 
+    /** @public Load only the given tags from a file, the other saved data is kept. Indexed files only read and decode the blocks holding these tags **/
+    UFUNCTION(BlueprintCallable)
+    bool LoadTagsFromFile(const FString& FileName, const TArray<FString>& Tags);
+
+    /** @public Get the tags stored in a file. Indexed files only read their table of contents **/
+    UFUNCTION(BlueprintCallable)
+    TArray<FString> GetSaveFileTags(const FString& FileName);
+
+    /** @public Save all data to a file on a background task. The future is set on the game thread after OnFileSaveComplete is broadcast **/
+    TFuture<bool> SaveDataInFileAsync(FString FileName = TEXT(""));
+
+    /**
+     * @public Load data from a file on a background task. The future is set on the game thread after the data is replaced and OnFileLoadComplete is broadcast.
+     * Tags whose data is taken for a save after the load starts keep that data, every other tag is replaced by the file or dropped if the file does not hold it.
+     */
+    TFuture<bool> LoadDataFromFileAsync(const FString& FileName);
+
     /** @public Get all save files in the save directory **/
     UFUNCTION(BlueprintCallable)
     TArray<FString> GetAllSaveFiles();
 
     /** @public Check if any save/load action is in process **/
     UFUNCTION(BlueprintCallable)
-    bool IsActionDataProcess() { return ActionDataAsyncTask.Get() != nullptr || RequestActionData.Num() != 0; }
+    bool IsActionDataProcess() { return !SubmittedRequests.IsEmpty() || TagsInProcess.Num() != 0 || RequestActionData.Num() != 0 || FileActionsInProcess != 0 || WorldAction.IsActive(); }
+
+    /** @public Override the time per frame spent on starting queued requests, e.g. raise it on a loading screen. 0 returns to the value of the settings **/
+    UFUNCTION(BlueprintCallable)
+    void SetFrameBudgetMs(float InFrameBudgetMs) { FrameBudgetMs = FMath::Max(InFrameBudgetMs, 0.0f); }
+
+    /** @public Get the time per frame spent on starting queued requests **/
+    UFUNCTION(BlueprintCallable)
+    float GetFrameBudgetMs() const;
 
 protected:
     /** @protected Generate a save file name based on the current date and time **/
     virtual FString GenerateSaveFileName();
 
 private:
-    /** @private Process the next request in the action data queue **/
-    void NextRequestActionData();
+    /** @private The file tests go through the container helpers directly **/
+    friend class FSaveGSystemFileJsonContainerTest;
+    friend class FSaveGSystemFileMappedReadTest;
+    friend class FSaveGSystemFileAsyncTest;
+
+    /** @private Check if the decompressed file data starts with the binary container magic number **/
+    static bool IsBinaryContainer(const TArray<uint8>& Data);
+
+    /** @private Write all tags into a binary container: magic, version, the merged name table and length-prefixed tag data **/
+    static void SerializeBinaryContainer(const FTagDataMap_SaveGSystem& InSaveGData, TArray<uint8>& OutData);
+
+    /** @private Read all tags of a binary container **/
+    static bool DeserializeBinaryContainer(const TArray<uint8>& Data, FTagDataMap_SaveGSystem& OutSaveGData);
+
+    /** @private Check if the file starts with the indexed save file magic number, the archive is left at the start **/
+    static bool IsIndexedContainer(FArchive& Ar);
+
+    /** @private Write the tags into an indexed file: header, table of contents and the compressed binary containers of groups of tags **/
+    static bool SerializeIndexedContainer(const FTagDataMap_SaveGSystem& InSaveGData, TArray<uint8>& OutData);
+
+    /** @private Read the header and the table of contents of an indexed file, the archive is left at the first block **/
+    static bool ReadIndexedToc(FArchive& Ar, TArray<FSaveFileBlock_SaveGSystem>& OutBlocks, TArray<FSaveFileTocEntry_SaveGSystem>& OutEntries);
+
+    /**
+     * @private Read the tags of an indexed file, all of them if Tags is null. Only the blocks holding the tags are read.
+     * With MappedData the blocks are decoded right from the mapped file, otherwise they are read through the archive.
+     */
+    static bool DeserializeIndexedContainer(FArchive& Ar, TConstArrayView<uint8> MappedData, const TSet<FString>* Tags, FTagDataMap_SaveGSystem& OutSaveGData);
+
+    /** @private Write all JSON tags into a JSON container, every tag payload is embedded as a nested object **/
+    static void SerializeJsonContainer(const FTagDataMap_SaveGSystem& InSaveGData, TArray<uint8>& OutData);
+
+    /** @private Read all tags of a JSON container, slicing nested objects out without parsing them **/
+    static bool DeserializeJsonContainer(const TArray<uint8>& Data, FTagDataMap_SaveGSystem& OutSaveGData);
+
+    /** @private Check if the tags have to be written to the binary container. The JSON container can only hold JSON tags **/
+    static bool IsBinaryContainerRequired(const FTagDataMap_SaveGSystem& InSaveGData);
+
+    /** @private Get the path of a save file in the save directory **/
+    static FString GetSaveFilePath(const FString& FileName, const TCHAR* Extension);
+
+    /** @private Encode, compress and write the tags to a file. Safe to call from any thread **/
+    static bool WriteSaveFile(const FTagDataMap_SaveGSystem& InSaveGData, const FString& FileName, bool bBinaryContainer, bool bSaveJsonFile);
+
+    /** @private Read, decompress and decode the tags of a file, all of them if Tags is null. Without bAllowMapping the file is read through an archive. Safe to call from any thread **/
+    static bool ReadSaveFile(const FString& FileName, FTagDataMap_SaveGSystem& OutSaveGData, const TSet<FString>* Tags = nullptr, bool bAllowMapping = true);
+
+    /** @private Map the whole file for reading, null if the platform cannot map it. The region has to be released before the handle **/
+    static TUniquePtr<IMappedFileRegion> MapSaveFile(const FString& FilePath, TUniquePtr<IMappedFileHandle>& OutMappedHandle);
+
+    /** @private Decode the tags of an opened file, MappedData holds the whole file if it is mapped **/
+    static bool ReadSaveFileData(const FString& FileName, FArchive& Ar, TConstArrayView<uint8> MappedData, FTagDataMap_SaveGSystem& OutSaveGData, const TSet<FString>* Tags);
+
+    /** @private Read the tags stored in a file. Safe to call from any thread **/
+    static bool ReadSaveFileTags(const FString& FileName, TArray<FString>& OutTags);
+
+    /** @private Find the stored data of a tag, a tag saved during an async file save is found in the delta first **/
+    const FTagDataRef_SaveGSystem* FindSaveGData(const FString& Tag) const;
+
+    /** @private Store the data of a tag. While an async file save holds the map, the tag goes to the delta instead of a copy of the map **/
+    void StoreSaveGData(const FString& Tag, const FTagDataRef_SaveGSystem& Data);
+
+    /** @private Replace all stored data, e.g. with the tags of a loaded file **/
+    void ResetSaveGData(FTagDataMap_SaveGSystem&& Data);
+
+    /** @private Move the delta into the map once no async file save holds it anymore **/
+    void MergeSaveGDataDelta();
+
+    /** @private Get all stored data with the delta applied. Copies the map only while the delta is not empty **/
+    static const FTagDataMap_SaveGSystem& MergeTagData(const FTagDataMap_SaveGSystem& Base, const FTagDataMap_SaveGSystem& Delta, FTagDataMap_SaveGSystem& OutMerged);
+
+    /** @private Queue a request behind the pending requests of its tag. A save replaces a pending save of the tag that is last in line **/
+    void AddRequestActionData(FInitDataAsyncTask_SaveGSystem&& Request);
 
-    /** @private Handle the completion of an async task **/
-    UFUNCTION()
-    void RegisterCompleteActionDataAsyncTask(const FString& Tag, UObject* SavedObject);
+    /** @private Make a save request with the serialization settings of the moment **/
+    static FInitDataAsyncTask_SaveGSystem MakeSaveRequest(const FString& Tag, UObject* SavedObject);
+
+    /** @private Make a load request **/
+    static FInitDataAsyncTask_SaveGSystem MakeLoadRequest(const FString& Tag, UObject* SavedObject);
+
+    /** @private Take the submitted requests, then spend the frame budget on the queued requests and on the world action **/
+    bool TickRequestActionData(float DeltaTime);
+
+    /** @private Queue the requests submitted from other threads **/
+    void DrainSubmittedRequests();
+
+    /** @private Start queued requests until the end time or the concurrency limit is reached **/
+    void StartRequestActionData(double EndTime);
+
+    /** @private Start a SaveWorld/LoadWorld unless one is in process **/
+    bool StartWorldAction(ETaskAction_SaveGSystem Action, const UObject* WorldContextObject);
+
+    /** @private Gather and process participants of the world action until the end time, at least one step per frame **/
+    void TickWorldAction(double EndTime);
+
+    /** @private Check the next chunk of actors for the interface **/
+    void GatherWorldActionStep(UWorld* World);
+
+    /** @private Reset the world action and notify about its completion **/
+    void FinishWorldAction();
+
+    /** @private Copy the properties of the object on the game thread and encode them on a worker thread **/
+    void ProcessSaveRequest(const FInitDataAsyncTask_SaveGSystem& InitData);
+
+    /** @private Serialize the object on the calling thread and store the data at once **/
+    void ProcessSaveRequestImmediate(FInitDataAsyncTask_SaveGSystem& InitData);
+
+    /** @private Store the data of a save and notify about it. Data taken before the stored data of the tag is dropped and false is returned **/
+    bool CompleteSaveRequest(const FString& Tag, UObject* SavedObject, FTagData_SaveGSystem&& SaveData, uint64 Generation);
+
+    /** @private Load the stored data of the tag into the object **/
+    bool ProcessLoadRequest(const FInitDataAsyncTask_SaveGSystem& InitData);
 
 #pragma endregion
 
@@ -90,6 +281,38 @@ public:
         BindDelegateActionSaveGSystemSignature(OnActionSaveComplete, Object, Func);
     }
 
+    /** @public Bind a function to the OnWorldActionProgress delegate **/
+    template <typename FuncClass>
+    void BindOnWorldActionProgress(FuncClass* Object, void (FuncClass::*Func)(float))
+    {
+        if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return;
+        if (CLOG_SAVE_G_SYSTEM(Func == nullptr, "Func is nullptr")) return;
+        OnWorldActionProgress.AddUniqueDynamic(Object, Func);
+    }
+
+    /** @public Bind a function to the OnWorldActionComplete delegate **/
+    template <typename FuncClass>
+    void BindOnWorldActionComplete(FuncClass* Object, void (FuncClass::*Func)(bool, int32))
+    {
+        if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return;
+        if (CLOG_SAVE_G_SYSTEM(Func == nullptr, "Func is nullptr")) return;
+        OnWorldActionComplete.AddUniqueDynamic(Object, Func);
+    }
+
+    /** @public Bind a function to the OnFileSaveComplete delegate **/
+    template <typename FuncClass>
+    void BindOnFileSaveComplete(FuncClass* Object, void (FuncClass::*Func)(const FString&, bool))
+    {
+        BindDelegateFileActionSaveGSystemSignature(OnFileSaveComplete, Object, Func);
+    }
+
+    /** @public Bind a function to the OnFileLoadComplete delegate **/
+    template <typename FuncClass>
+    void BindOnFileLoadComplete(FuncClass* Object, void (FuncClass::*Func)(const FString&, bool))
+    {
+        BindDelegateFileActionSaveGSystemSignature(OnFileLoadComplete, Object, Func);
+    }
+
 protected:
     /** @protected Template function to bind a delegate with a specific signature FActionSaveGSystemSignature **/
     template <typename FuncClass>
@@ -100,6 +323,15 @@ protected:
         Delegate.AddUniqueDynamic(Object, Func);
     }
 
+    /** @protected Template function to bind a delegate with a specific signature FFileActionSaveGSystemSignature **/
+    template <typename FuncClass>
+    void BindDelegateFileActionSaveGSystemSignature(FFileActionSaveGSystemSignature& Delegate, FuncClass* Object, void (FuncClass::*Func)(const FString&, bool))
+    {
+        if (CLOG_SAVE_G_SYSTEM(Object == nullptr, "Object is nullptr")) return;
+        if (CLOG_SAVE_G_SYSTEM(Func == nullptr, "Func is nullptr")) return;
+        Delegate.AddUniqueDynamic(Object, Func);
+    }
+
 private:
     /** @private Delegate for load completion **/
     FActionSaveGSystemSignature OnActionLoadComplete;
@@ -107,19 +339,58 @@ private:
     /** @private Delegate for save completion **/
     FActionSaveGSystemSignature OnActionSaveComplete;
 
+    /** @private Delegate for the progress (0-1) of SaveWorld/LoadWorld, broadcast every frame it runs **/
+    FWorldProgressSaveGSystemSignature OnWorldActionProgress;
+
+    /** @private Delegate for completion of SaveWorld/LoadWorld **/
+    FWorldActionSaveGSystemSignature OnWorldActionComplete;
+
+    /** @private Delegate for completion of an async file save **/
+    FFileActionSaveGSystemSignature OnFileSaveComplete;
+
+    /** @private Delegate for completion of an async file load **/
+    FFileActionSaveGSystemSignature OnFileLoadComplete;
+
 #pragma endregion
 
 #pragma region Data
 
 private:
-    /** @private Async task for processing save/load actions **/
-    TWeakObjectPtr<UUpdateSaveDataAsyncTask> ActionDataAsyncTask;
+    /** @private Requests submitted from any thread, drained on the game thread **/
+    TQueue<FInitDataAsyncTask_SaveGSystem, EQueueMode::Mpsc> SubmittedRequests;
+
+    /** @private Tags whose save is being encoded on a worker thread **/
+    TSet<FString> TagsInProcess;
+
+    /** @private Pending save/load requests of each tag in the order they were made **/
+    TMap<FString, TDeque<FInitDataAsyncTask_SaveGSystem>> RequestActionData;
+
+    /** @private Tags that have pending requests and no action in process, in the order they may start **/
+    TDeque<FString> ReadyTags;
+
+    /** @private SaveWorld/LoadWorld in process **/
+    FWorldAction_SaveGSystem WorldAction;
+
+    /** @private Number of async file saves/loads in process **/
+    int32 FileActionsInProcess{0};
+
+    /** @private Time per frame set through SetFrameBudgetMs, 0 if the settings are used **/
+    float FrameBudgetMs{0.0f};
+
+    /** @private **/
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    /** @private Generation of the last data taken for a save, every save takes the next one **/
+    uint64 SaveGeneration{0};
+
+    /** @private Generation of the stored data of each tag **/
+    TMap<FString, uint64> StoredGenerations;
 
-    /** @private Request Queue for save/load actions **/
-    TArray<FInitDataAsyncTask_SaveGSystem> RequestActionData;
+    /** @private Map to store save data with tags as keys. Async file saves hold a reference to it instead of a copy **/
+    TSharedRef<FTagDataMap_SaveGSystem, ESPMode::ThreadSafe> SaveGData{MakeShared<FTagDataMap_SaveGSystem, ESPMode::ThreadSafe>()};
 
-    /** @private Map to store save data with tags as keys **/
-    TMap<FString, FString> SaveGData;
+    /** @private Tags saved while an async file save holds SaveGData. They win over SaveGData and are merged into it when the last file save completes **/
+    FTagDataMap_SaveGSystem SaveGDataDelta;
 
 #pragma endregion
 };
\ No newline at end of file
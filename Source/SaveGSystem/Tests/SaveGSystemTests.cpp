@@ -1,8 +1,16 @@
 ﻿
 #include "SaveGSystem/Tests/SaveGSystemTests.h"
 
+#include "Algo/AnyOf.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "SaveGSystem/Library/SaveGLibrary.h"
+#include "SaveGSystem/Library/SaveGNameTableArchive.h"
+#include "SaveGSystem/Library/SaveGPropertyPlan.h"
+#include "SaveGSystem/Library/SaveGPropertySnapshot.h"
 #include "SaveGSystem/SubSystem/SaveGSubSystem.h"
+#include "Serialization/ArchiveSaveCompressedProxy.h"
+#include "Serialization/MemoryReader.h"
 
 #if WITH_AUTOMATION_TESTS
 
@@ -20,7 +28,9 @@ bool RunSaveGSystemTest(const FString& TagName, FAutomationTestBase* Test)
     TestObject->Generate();
     TestWorld.WeakSaveGSubSystem->UpdateSaveData(TagName, TestObject);
 
-    FWorldSimulationTicker SavedSimulateTick([TestObject]() { return TestObject->IsSaved(); }, 6.0f, TestWorld.WeakWorld.Get());
+    // PostSave comes right after the snapshot, the tag shows up once the worker thread has encoded it
+    FWorldSimulationTicker SavedSimulateTick([&TestWorld, TestObject, TagName]() { return TestObject->IsSaved() && TestWorld.WeakSaveGSubSystem->IsHaveTag(TagName); }, 6.0f,
+        TestWorld.WeakWorld.Get());
     SavedSimulateTick.Run();
 
     if (!Test->TestTrue(TEXT("TestObject is not saved in subsystem"), TestObject->IsSaved())) return false;
@@ -36,6 +46,68 @@ bool RunSaveGSystemTest(const FString& TagName, FAutomationTestBase* Test)
 
     return true;
 }
+
+template <typename ObjectType>
+bool RunSaveGSystemFormatParityTest(FAutomationTestBase* Test)
+{
+    ObjectType* SourceObject = NewObject<ObjectType>();
+    ObjectType* JsonObject = NewObject<ObjectType>();
+    ObjectType* BinaryObject = NewObject<ObjectType>();
+    if (!Test->TestTrue(TEXT("Test objects are not created"), SourceObject && JsonObject && BinaryObject)) return false;
+
+    SourceObject->Generate();
+
+    FTagData_SaveGSystem JsonData;
+    FTagData_SaveGSystem BinaryData;
+    JsonData.Format = ESerializeFormat_SaveGSystem::Json;
+    BinaryData.Format = ESerializeFormat_SaveGSystem::Binary;
+    if (!Test->TestTrue(TEXT("JSON serialization failed"), USaveGLibrary::SerializeObject(SourceObject, JsonData))) return false;
+    if (!Test->TestTrue(TEXT("Binary serialization failed"), USaveGLibrary::SerializeObject(SourceObject, BinaryData))) return false;
+
+    if (!Test->TestTrue(TEXT("JSON deserialization failed"), USaveGLibrary::DeserializeObject(JsonObject, JsonData))) return false;
+    if (!Test->TestTrue(TEXT("Binary deserialization failed"), USaveGLibrary::DeserializeObject(BinaryObject, BinaryData))) return false;
+
+    if (!Test->TestTrue(TEXT("Binary object has invalid values"), BinaryObject->IsValidValue())) return false;
+    for (FProperty* Property : USaveGLibrary::GetAllPropertyHasMetaSaveGame(SourceObject))
+    {
+        Test->TestTrue(FString::Printf(TEXT("Property %s differs between JSON and binary"), *Property->GetName()), Property->Identical_InContainer(JsonObject, BinaryObject));
+    }
+    Test->AddInfo(FString::Printf(TEXT("JSON bytes: %i | Binary bytes: %i | Binary names: %i"), JsonData.Data.Num(), BinaryData.Data.Num(), BinaryData.Names.Num()));
+    return !Test->HasAnyErrors();
+}
+
+template <typename ObjectType>
+bool RunSaveGSystemJsonStreamParityTest(FAutomationTestBase* Test)
+{
+    ObjectType* SourceObject = NewObject<ObjectType>();
+    ObjectType* TreeObject = NewObject<ObjectType>();
+    ObjectType* StreamObject = NewObject<ObjectType>();
+    ObjectType* TreeTextObject = NewObject<ObjectType>();
+    if (!Test->TestTrue(TEXT("Test objects are not created"), SourceObject && TreeObject && StreamObject && TreeTextObject)) return false;
+
+    SourceObject->Generate();
+
+    // The streamed output must load through the same reader as the JSON object tree output
+    const FString TreeJson = USaveGLibrary::SerializeObjectJson(SourceObject);
+    FTagData_SaveGSystem StreamData;
+    StreamData.Format = ESerializeFormat_SaveGSystem::Json;
+    if (!Test->TestTrue(TEXT("JSON stream serialization failed"), USaveGLibrary::SerializeObject(SourceObject, StreamData))) return false;
+
+    if (!Test->TestTrue(TEXT("JSON tree deserialization failed"), USaveGLibrary::DeserializeObjectJson(TreeObject, TreeJson))) return false;
+    if (!Test->TestTrue(TEXT("JSON stream deserialization failed"), USaveGLibrary::DeserializeObject(StreamObject, StreamData))) return false;
+
+    // The token reader must also accept the pretty printed text of the JSON object tree
+    if (!Test->TestTrue(TEXT("JSON token reader failed on tree text"), USaveGLibrary::DeserializeObjectJson(TreeTextObject, USaveGLibrary::ConvertStringToByte(TreeJson))))
+        return false;
+
+    if (!Test->TestTrue(TEXT("Streamed object has invalid values"), StreamObject->IsValidValue())) return false;
+    for (FProperty* Property : USaveGLibrary::GetAllPropertyHasMetaSaveGame(SourceObject))
+    {
+        Test->TestTrue(FString::Printf(TEXT("Property %s differs between JSON tree and stream"), *Property->GetName()), Property->Identical_InContainer(TreeObject, StreamObject));
+        Test->TestTrue(FString::Printf(TEXT("Property %s differs between JSON tree and token reader"), *Property->GetName()), Property->Identical_InContainer(TreeObject, TreeTextObject));
+    }
+    return !Test->HasAnyErrors();
+}
 }  // namespace SaveGSystemTests
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemArchiveBoolTest, "SaveGSystem.Archive.BoolTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
@@ -81,12 +153,847 @@ bool FSaveGSystemArchiveArrayStructTest::RunTest(const FString& Parameters)
     return SaveGSystemTests::RunSaveGSystemTest<USaveGTestArrayStructObject>("TestArrayStructObject", this);
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSaveGSystemArchiveArrayNumericTest, "SaveGSystem.Archive.ArrayNumericTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemArchiveArrayNumericTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemTest<USaveGTestArrayNumericObject>("TestArrayNumericObject", this);
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemArchiveMapTest, "SaveGSystem.Archive.MapTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 bool FSaveGSystemArchiveMapTest::RunTest(const FString& Parameters)
 {
     return SaveGSystemTests::RunSaveGSystemTest<USaveGTestMapStructObject>("TestMapStructObject", this);
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemArchiveSetTest, "SaveGSystem.Archive.SetTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemArchiveSetTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemTest<USaveGTestSetObject>("TestSetObject", this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemQueueTagOrderTest, "SaveGSystem.Queue.TagOrderTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemQueueTagOrderTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    // Several tags are in process at once, while the load of each tag still waits for its save
+    TArray<USaveGTestNumericObject*> SavedObjects;
+    TArray<USaveGTestNumericObject*> LoadedObjects;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        const FString Tag = FString::Printf(TEXT("TestQueueObject_%i"), Index);
+        USaveGTestNumericObject* SavedObject = SavedObjects.Add_GetRef(NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+        USaveGTestNumericObject* LoadedObject = LoadedObjects.Add_GetRef(NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+        SavedObject->Generate();
+        TestWorld.WeakSaveGSubSystem->UpdateSaveData(Tag, SavedObject);
+        TestWorld.WeakSaveGSubSystem->LoadSaveData(Tag, LoadedObject);
+    }
+
+    FWorldSimulationTicker SimulateTick([&TestWorld]() { return !TestWorld.WeakSaveGSubSystem->IsActionDataProcess(); }, 6.0f, TestWorld.WeakWorld.Get());
+    SimulateTick.Run();
+
+    for (int32 Index = 0; Index < LoadedObjects.Num(); ++Index)
+    {
+        TestTrue(FString::Printf(TEXT("Object %i is not loaded"), Index), LoadedObjects[Index]->IsLoaded());
+        TestTrue(FString::Printf(TEXT("Object %i is loaded before its save"), Index), LoadedObjects[Index]->IsValidValue());
+    }
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemQueueCoalesceTest, "SaveGSystem.Queue.CoalesceTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemQueueCoalesceTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    // Saves waiting in a row are merged into the latest one, a load in between keeps the save before it
+    const FString Tag = TEXT("TestCoalesceObject");
+    TArray<USaveGTestNumericObject*> SavedObjects;
+    for (int32 Index = 0; Index < 5; ++Index)
+    {
+        USaveGTestNumericObject* SavedObject = SavedObjects.Add_GetRef(NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+        SavedObject->Generate();
+        TestWorld.WeakSaveGSubSystem->UpdateSaveData(Tag, SavedObject);
+    }
+    USaveGTestNumericObject* LoadedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    TestWorld.WeakSaveGSubSystem->LoadSaveData(Tag, LoadedObject);
+    USaveGTestNumericObject* LastSavedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    TestWorld.WeakSaveGSubSystem->UpdateSaveData(Tag, LastSavedObject);
+
+    FWorldSimulationTicker SimulateTick([&TestWorld]() { return !TestWorld.WeakSaveGSubSystem->IsActionDataProcess(); }, 6.0f, TestWorld.WeakWorld.Get());
+    SimulateTick.Run();
+
+    for (int32 Index = 0; Index < SavedObjects.Num() - 1; ++Index)
+    {
+        TestFalse(FString::Printf(TEXT("Replaced save %i is processed"), Index), SavedObjects[Index]->IsSaved());
+    }
+    TestTrue(TEXT("Latest save is not processed"), SavedObjects.Last()->IsSaved() && LastSavedObject->IsSaved());
+    TestTrue(TEXT("Object is not loaded"), LoadedObject->IsLoaded() && LoadedObject->IsValidValue());
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemQueueSubmitTest, "SaveGSystem.Queue.SubmitTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemQueueSubmitTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    // Every worker owns its objects, copies them and submits the copies together with a regular save
+    constexpr int32 NumWorkers = 4;
+    constexpr int32 NumObjectsPerWorker = 16;
+    TArray<USaveGTestNumericObject*> SavedObjects;
+    for (int32 Index = 0; Index < NumWorkers * NumObjectsPerWorker; ++Index)
+    {
+        SavedObjects.Add_GetRef(NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()))->Generate();
+    }
+    USaveGSubSystem* SaveGSubSystem = TestWorld.WeakSaveGSubSystem.Get();
+
+    // The plan of the class is first built off the game thread, as it is for a snapshot made by a worker
+    FSaveGPropertyPlan::Invalidate();
+    const bool bWorkerPlanHasDefaults = Async(EAsyncExecution::Thread,
+        []() { return !IsInGameThread() && FSaveGPropertyPlan::Get(USaveGTestNumericObject::StaticClass())->GetDefaults() != nullptr; }).Get();
+    TestTrue(TEXT("Plan built on a worker has no class defaults"), bWorkerPlanHasDefaults);
+    ParallelFor(NumWorkers,
+        [&](int32 Worker)
+        {
+            for (int32 Index = Worker * NumObjectsPerWorker; Index < (Worker + 1) * NumObjectsPerWorker; ++Index)
+            {
+                const FString Tag = FString::Printf(TEXT("TestSubmitObject_%i"), Index);
+                if (Index % 2 == 0)
+                {
+                    SaveGSubSystem->SubmitSnapshot(Tag, MakeShared<const FSaveGPropertySnapshot, ESPMode::ThreadSafe>(SavedObjects[Index]));
+                }
+                else
+                {
+                    SaveGSubSystem->SubmitUpdateSaveData(Tag, SavedObjects[Index]);
+                }
+            }
+        });
+    TestTrue(TEXT("Submitted requests are not reported in process"), SaveGSubSystem->IsActionDataProcess());
+
+    FWorldSimulationTicker SimulateTick([SaveGSubSystem]() { return !SaveGSubSystem->IsActionDataProcess(); }, 6.0f, TestWorld.WeakWorld.Get());
+    SimulateTick.Run();
+
+    for (int32 Index = 0; Index < SavedObjects.Num(); ++Index)
+    {
+        USaveGTestNumericObject* LoadedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+        SaveGSubSystem->LoadSaveDataImmediate(FString::Printf(TEXT("TestSubmitObject_%i"), Index), LoadedObject);
+        TestTrue(FString::Printf(TEXT("Object %i is not loaded"), Index), LoadedObject->IsLoaded() && LoadedObject->IsValidValue());
+    }
+    // The hooks run only for the objects the subsystem copied itself
+    TestFalse(TEXT("Hooks are called for a submitted snapshot"), SavedObjects[0]->IsSaved());
+    TestTrue(TEXT("Hooks are not called for a submitted save"), SavedObjects[1]->IsSaved());
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemQueueFutureTest, "SaveGSystem.Queue.FutureTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemQueueFutureTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    const FString Tag = TEXT("TestFutureObject");
+    USaveGTestNumericObject* SavedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    USaveGTestNumericObject* LoadedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    SavedObject->Generate();
+
+    // The replaced save resolves together with the save that took its place
+    TFuture<bool> ReplacedSaveFuture = TestWorld.WeakSaveGSubSystem->UpdateSaveDataAsync(Tag, NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+    TFuture<bool> SaveFuture = TestWorld.WeakSaveGSubSystem->UpdateSaveDataAsync(Tag, SavedObject);
+    bool bLoadedInContinuation = false;
+    TFuture<void> LoadFuture = TestWorld.WeakSaveGSubSystem->LoadSaveDataAsync(Tag, LoadedObject).Next([&](bool bSuccess) { bLoadedInContinuation = bSuccess && LoadedObject->IsLoaded(); });
+    TFuture<bool> MissingFuture = TestWorld.WeakSaveGSubSystem->LoadSaveDataAsync(TEXT("TestFutureMissingObject"), LoadedObject);
+    TestTrue(TEXT("Load of a missing tag is not rejected at once"), MissingFuture.IsReady() && !MissingFuture.Get());
+
+    FWorldSimulationTicker SimulateTick([&LoadFuture]() { return LoadFuture.IsReady(); }, 6.0f, TestWorld.WeakWorld.Get());
+    SimulateTick.Run();
+
+    TestTrue(TEXT("Replaced save is not resolved"), ReplacedSaveFuture.IsReady() && ReplacedSaveFuture.Get());
+    TestTrue(TEXT("Save is not resolved"), SaveFuture.IsReady() && SaveFuture.Get());
+    TestTrue(TEXT("Load is not resolved after the object is loaded"), bLoadedInContinuation && LoadedObject->IsValidValue());
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemQueueFrameBudgetTest, "SaveGSystem.Queue.FrameBudgetTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemQueueFrameBudgetTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    TArray<USaveGTestNumericObject*> LoadedObjects;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        USaveGTestNumericObject* SavedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+        SavedObject->Generate();
+        TestWorld.WeakSaveGSubSystem->UpdateSaveData(FString::Printf(TEXT("TestBudgetObject_%i"), Index), SavedObject);
+        LoadedObjects.Add(NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+    }
+    FWorldSimulationTicker SaveTick([&TestWorld]() { return !TestWorld.WeakSaveGSubSystem->IsActionDataProcess(); }, 6.0f, TestWorld.WeakWorld.Get());
+    SaveTick.Run();
+
+    // A budget that is spent by the first request leaves the rest of the queue for the next frames
+    TestWorld.WeakSaveGSubSystem->SetFrameBudgetMs(UE_KINDA_SMALL_NUMBER);
+    for (int32 Index = 0; Index < LoadedObjects.Num(); ++Index)
+    {
+        TestWorld.WeakSaveGSubSystem->LoadSaveData(FString::Printf(TEXT("TestBudgetObject_%i"), Index), LoadedObjects[Index]);
+    }
+    FTSTicker::GetCoreTicker().Tick(0.016f);
+    TestTrue(TEXT("First request is not started"), LoadedObjects[0]->IsLoaded());
+    TestFalse(TEXT("Requests over the budget are started"), LoadedObjects[1]->IsLoaded());
+
+    FWorldSimulationTicker LoadTick([&TestWorld]() { return !TestWorld.WeakSaveGSubSystem->IsActionDataProcess(); }, 6.0f, TestWorld.WeakWorld.Get());
+    LoadTick.Run();
+    for (int32 Index = 0; Index < LoadedObjects.Num(); ++Index)
+    {
+        TestTrue(FString::Printf(TEXT("Object %i is not loaded"), Index), LoadedObjects[Index]->IsLoaded() && LoadedObjects[Index]->IsValidValue());
+    }
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemQueueImmediateTest, "SaveGSystem.Queue.ImmediateTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemQueueImmediateTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    // Nothing is queued and no frame has to pass for the immediate actions
+    TMap<FString, UObject*> SavedObjects;
+    TMap<FString, UObject*> LoadedObjects;
+    for (int32 Index = 0; Index < 8; ++Index)
+    {
+        const FString Tag = FString::Printf(TEXT("TestImmediateObject_%i"), Index);
+        USaveGTestNumericObject* SavedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+        SavedObject->Generate();
+        SavedObjects.Add(Tag, SavedObject);
+        LoadedObjects.Add(Tag, NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+    }
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediateBatch(SavedObjects);
+    TestFalse(TEXT("Immediate save is queued"), TestWorld.WeakSaveGSubSystem->IsActionDataProcess());
+    TestWorld.WeakSaveGSubSystem->LoadSaveDataImmediateBatch(LoadedObjects);
+
+    for (const auto& [Tag, Object] : LoadedObjects)
+    {
+        USaveGTestNumericObject* SavedObject = Cast<USaveGTestNumericObject>(SavedObjects[Tag]);
+        USaveGTestNumericObject* LoadedObject = Cast<USaveGTestNumericObject>(Object);
+        TestTrue(FString::Printf(TEXT("%s is not saved"), *Tag), SavedObject->IsSaved() && TestWorld.WeakSaveGSubSystem->IsHaveTag(Tag));
+        TestTrue(FString::Printf(TEXT("%s is not loaded"), *Tag), LoadedObject->IsLoaded() && LoadedObject->IsValidValue());
+    }
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemQueueImmediateOrderTest, "SaveGSystem.Queue.ImmediateOrderTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemQueueImmediateOrderTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    // The async save takes its data first and completes after the immediate save
+    const FString Tag = TEXT("TestImmediateOrderObject");
+    USaveGTestNumericObject* SavedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    TFuture<bool> AsyncFuture = TestWorld.WeakSaveGSubSystem->UpdateSaveDataAsync(Tag, SavedObject);
+    FTSTicker::GetCoreTicker().Tick(0.016f);
+    TestTrue(TEXT("Async save is not in process"), TestWorld.WeakSaveGSubSystem->IsActionDataProcess());
+
+    SavedObject->Generate();
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediate(Tag, SavedObject);
+    FWorldSimulationTicker SimulateTick([&AsyncFuture]() { return AsyncFuture.IsReady(); }, 6.0f, TestWorld.WeakWorld.Get());
+    SimulateTick.Run();
+    TestTrue(TEXT("Older async save is not dropped"), AsyncFuture.IsReady() && !AsyncFuture.Get());
+
+    USaveGTestNumericObject* LoadedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    TestWorld.WeakSaveGSubSystem->LoadSaveDataImmediate(Tag, LoadedObject);
+    TestTrue(TEXT("Data of the immediate save is replaced"), LoadedObject->IsLoaded() && LoadedObject->IsValidValue());
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemWorldActionTest, "SaveGSystem.World.ActionTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemWorldActionTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    // More actors than one gathering step, with a budget that takes a single step per frame
+    constexpr int32 NumActors = SaveGSystemSpace::WorldGatherChunkSize + 44;
+    TArray<ASaveGTestActor*> Actors;
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        ASaveGTestActor* Actor = Actors.Add_GetRef(TestWorld.WeakWorld->SpawnActor<ASaveGTestActor>());
+        if (!TestNotNull(TEXT("Actor is not spawned"), Actor)) return false;
+        Actor->Value = Index + 1;
+    }
+
+    USaveGTestWorldListener* Listener = NewObject<USaveGTestWorldListener>();
+    TestWorld.WeakSaveGSubSystem->BindOnWorldActionProgress(Listener, &USaveGTestWorldListener::OnProgress);
+    TestWorld.WeakSaveGSubSystem->BindOnWorldActionComplete(Listener, &USaveGTestWorldListener::OnComplete);
+    TestWorld.WeakSaveGSubSystem->SetFrameBudgetMs(UE_KINDA_SMALL_NUMBER);
+
+    TestTrue(TEXT("SaveWorld is not started"), TestWorld.WeakSaveGSubSystem->SaveWorld(TestWorld.WeakWorld.Get()));
+    TestFalse(TEXT("Second SaveWorld is started"), TestWorld.WeakSaveGSubSystem->SaveWorld(TestWorld.WeakWorld.Get()));
+    FTSTicker::GetCoreTicker().Tick(0.016f);
+    TestTrue(TEXT("SaveWorld is done in one frame"), TestWorld.WeakSaveGSubSystem->IsWorldActionProcess());
+
+    FWorldSimulationTicker SaveTick([&TestWorld]() { return !TestWorld.WeakSaveGSubSystem->IsWorldActionProcess(); }, 30.0f, TestWorld.WeakWorld.Get());
+    SaveTick.Run();
+    TestEqual(TEXT("SaveWorld completion"), Listener->NumCompleted, 1);
+    TestEqual(TEXT("SaveWorld actors"), Listener->NumActors, NumActors);
+    TestEqual(TEXT("SaveWorld progress"), Listener->LastProgress, 1.0f);
+
+    for (ASaveGTestActor* Actor : Actors)
+    {
+        Actor->Value = 0;
+    }
+    TestWorld.WeakSaveGSubSystem->SetFrameBudgetMs(0.0f);
+    TestTrue(TEXT("LoadWorld is not started"), TestWorld.WeakSaveGSubSystem->LoadWorld(TestWorld.WeakWorld.Get()));
+    FWorldSimulationTicker LoadTick([&TestWorld]() { return !TestWorld.WeakSaveGSubSystem->IsWorldActionProcess(); }, 30.0f, TestWorld.WeakWorld.Get());
+    LoadTick.Run();
+    TestEqual(TEXT("LoadWorld completion"), Listener->NumCompleted, 2);
+    for (int32 Index = 0; Index < Actors.Num(); ++Index)
+    {
+        TestEqual(FString::Printf(TEXT("Actor %i value"), Index), Actors[Index]->Value, Index + 1);
+    }
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemFileAsyncTest, "SaveGSystem.File.AsyncTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemFileAsyncTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    const FString Tag = TEXT("TestAsyncFileObject");
+    const FString FileName = TEXT("SaveGSystemAsyncFileTest");
+    USaveGTestNumericObject* SavedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    SavedObject->Generate();
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediate(Tag, SavedObject);
+
+    TFuture<bool> SaveFuture = TestWorld.WeakSaveGSubSystem->SaveDataInFileAsync(FileName);
+    TestTrue(TEXT("File save is not reported in process"), TestWorld.WeakSaveGSubSystem->IsActionDataProcess());
+
+    // The file gets the tags of the moment it was requested, a save made meanwhile stays in memory only
+    const FString LateTag = TEXT("TestAsyncFileLateObject");
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediate(LateTag, NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+    TestTrue(TEXT("Late save is not stored"), TestWorld.WeakSaveGSubSystem->IsHaveTag(LateTag));
+    FWorldSimulationTicker SaveTick([&SaveFuture]() { return SaveFuture.IsReady(); }, 6.0f, TestWorld.WeakWorld.Get());
+    SaveTick.Run();
+    TestTrue(TEXT("File is not saved"), SaveFuture.IsReady() && SaveFuture.Get());
+
+    // The load replaces the tags saved before it started, a save made while the file is read is kept
+    TFuture<bool> LoadFuture = TestWorld.WeakSaveGSubSystem->LoadDataFromFileAsync(FileName);
+    const FString DuringLoadTag = TEXT("TestAsyncFileDuringLoadObject");
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediate(DuringLoadTag, NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+    FWorldSimulationTicker LoadTick([&LoadFuture]() { return LoadFuture.IsReady(); }, 6.0f, TestWorld.WeakWorld.Get());
+    LoadTick.Run();
+    TestTrue(TEXT("File is not loaded"), LoadFuture.IsReady() && LoadFuture.Get());
+    TestFalse(TEXT("File load is reported in process"), TestWorld.WeakSaveGSubSystem->IsActionDataProcess());
+    TestFalse(TEXT("Late save is written to the file"), TestWorld.WeakSaveGSubSystem->IsHaveTag(LateTag));
+    TestTrue(TEXT("Save made during the load is dropped"), TestWorld.WeakSaveGSubSystem->IsHaveTag(DuringLoadTag));
+
+    USaveGTestNumericObject* LoadedObject = NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get());
+    TestWorld.WeakSaveGSubSystem->LoadSaveDataImmediate(Tag, LoadedObject);
+    TestTrue(TEXT("Object is not loaded from the file"), LoadedObject->IsLoaded() && LoadedObject->IsValidValue());
+
+    // While a writer holds the map, a save goes to the delta and the held map is neither changed nor copied
+    USaveGSubSystem* SaveGSubSystem = TestWorld.WeakSaveGSubSystem.Get();
+    TSharedPtr<const FTagDataMap_SaveGSystem, ESPMode::ThreadSafe> HeldData = SaveGSubSystem->SaveGData;
+    const FString HeldTag = TEXT("TestAsyncFileHeldObject");
+    SaveGSubSystem->UpdateSaveDataImmediate(HeldTag, NewObject<USaveGTestNumericObject>(TestWorld.WeakWorld.Get()));
+    TestTrue(TEXT("Held map is copied"), HeldData.Get() == &SaveGSubSystem->SaveGData.Get());
+    TestFalse(TEXT("Held map is changed"), HeldData->Contains(HeldTag));
+    TestTrue(TEXT("Save made while the map is held is not found"), SaveGSubSystem->IsHaveTag(HeldTag));
+    HeldData.Reset();
+    SaveGSubSystem->MergeSaveGDataDelta();
+    TestTrue(TEXT("Delta is not merged once the map is released"), SaveGSubSystem->SaveGDataDelta.IsEmpty() && SaveGSubSystem->SaveGData->Contains(HeldTag));
+
+    IFileManager::Get().Delete(*(FPaths::ProjectSavedDir() + TEXT("SaveGame/") + FileName + TEXT(".SaveG")));
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemFileIndexedTest, "SaveGSystem.File.IndexedTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemFileIndexedTest::RunTest(const FString& Parameters)
+{
+    FInitTestWorld TestWorld;
+    if (!TestTrue(TEXT("TestWorld is not valid"), TestWorld.IsValid())) return false;
+
+    // Enough tag data for several blocks
+    const FString FileName = TEXT("SaveGSystemIndexedFileTest");
+    const FString FilePath = FPaths::ProjectSavedDir() + TEXT("SaveGame/") + FileName + TEXT(".SaveG");
+    TMap<FString, UObject*> SavedObjects;
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        USaveGTestArrayNumericObject* SavedObject = NewObject<USaveGTestArrayNumericObject>(TestWorld.WeakWorld.Get());
+        SavedObject->Generate();
+        SavedObjects.Add(FString::Printf(TEXT("TestIndexedObject_%i"), Index), SavedObject);
+    }
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediateBatch(SavedObjects);
+    TestWorld.WeakSaveGSubSystem->SaveDataInFile(FileName);
+
+    const TArray<FString> FileTags = TestWorld.WeakSaveGSubSystem->GetSaveFileTags(FileName);
+    TestEqual(TEXT("Tags of the table of contents"), FileTags.Num(), SavedObjects.Num());
+    for (const auto& [Tag, Object] : SavedObjects)
+    {
+        TestTrue(FString::Printf(TEXT("%s is not in the table of contents"), *Tag), FileTags.Contains(Tag));
+    }
+
+    // A partial load replaces only the given tag
+    const FString Tag = TEXT("TestIndexedObject_7");
+    const FString UnsavedTag = TEXT("TestIndexedUnsavedObject");
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediate(Tag, NewObject<USaveGTestArrayNumericObject>(TestWorld.WeakWorld.Get()));
+    TestWorld.WeakSaveGSubSystem->UpdateSaveDataImmediate(UnsavedTag, NewObject<USaveGTestArrayNumericObject>(TestWorld.WeakWorld.Get()));
+    TestTrue(TEXT("Tag is not loaded from the file"), TestWorld.WeakSaveGSubSystem->LoadTagsFromFile(FileName, {Tag}));
+    TestTrue(TEXT("Tag that is not in the file is dropped"), TestWorld.WeakSaveGSubSystem->IsHaveTag(UnsavedTag));
+
+    USaveGTestArrayNumericObject* LoadedObject = NewObject<USaveGTestArrayNumericObject>(TestWorld.WeakWorld.Get());
+    TestWorld.WeakSaveGSubSystem->LoadSaveDataImmediate(Tag, LoadedObject);
+    TestTrue(TEXT("Object is not loaded from the file"), LoadedObject->IsLoaded() && LoadedObject->IsValidValue());
+
+    // A damaged block is caught by its checksum, the table of contents still reads
+    TArray<uint8> FileData;
+    if (!TestTrue(TEXT("File is not written"), FFileHelper::LoadFileToArray(FileData, *FilePath))) return false;
+    FileData.Last() ^= 0xFF;
+    FFileHelper::SaveArrayToFile(FileData, *FilePath);
+    AddExpectedError(TEXT("indexed save file is corrupted"), EAutomationExpectedErrorFlags::Contains, 0);
+    TestEqual(TEXT("Tags of the damaged file"), TestWorld.WeakSaveGSubSystem->GetSaveFileTags(FileName).Num(), SavedObjects.Num());
+    TArray<FString> AllTags;
+    SavedObjects.GetKeys(AllTags);
+    TestFalse(TEXT("Damaged block is loaded"), TestWorld.WeakSaveGSubSystem->LoadTagsFromFile(FileName, AllTags));
+
+    // A block whose compressed header names another codec than the table of contents is rejected as well
+    FileData.Last() ^= 0xFF;
+    const int32 FirstBlockCodecOffset = sizeof(uint32) + sizeof(uint16) + sizeof(int32) + sizeof(int64) + sizeof(int32) + sizeof(uint32);
+    FileData[FirstBlockCodecOffset] ^= 0xFF;
+    FFileHelper::SaveArrayToFile(FileData, *FilePath);
+    AddExpectedError(TEXT("has a different codec than its table of contents entry"), EAutomationExpectedErrorFlags::Contains, 0);
+    AddExpectedError(TEXT("Failed to decode the indexed save file"), EAutomationExpectedErrorFlags::Contains, 0);
+    TestFalse(TEXT("Block with a mismatched codec is loaded"), TestWorld.WeakSaveGSubSystem->LoadTagsFromFile(FileName, AllTags));
+
+    IFileManager::Get().Delete(*FilePath);
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemFileJsonContainerTest, "SaveGSystem.File.JsonContainerTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemFileJsonContainerTest::RunTest(const FString& Parameters)
+{
+    const FString FileName = TEXT("SaveGSystemJsonContainerTest");
+    const FString FilePath = FPaths::ProjectSavedDir() + TEXT("SaveGame/") + FileName + TEXT(".SaveG");
+
+    // Tags that have to be escaped in the container
+    const TArray<FString> Tags{TEXT("Quote\"Tag"), TEXT("Back\\Slash\\Tag"), TEXT("Control\t\n\x01Tag"), TEXT("Unicode_\u00DC\u00F1\u65E5\u672C"), TEXT("Emoji_\U0001F600")};
+    FTagDataMap_SaveGSystem SavedData;
+    for (const FString& Tag : Tags)
+    {
+        USaveGTestStringObject* Object = NewObject<USaveGTestStringObject>();
+        Object->Generate();
+        FTagData_SaveGSystem TagData;
+        TagData.Format = ESerializeFormat_SaveGSystem::Json;
+        if (!TestTrue(TEXT("Object is not serialized"), USaveGLibrary::SerializeObjectJson(Object, TagData.Data))) return false;
+        SavedData.Add(Tag, MakeShared<const FTagData_SaveGSystem, ESPMode::ThreadSafe>(MoveTemp(TagData)));
+    }
+
+    FTagDataMap_SaveGSystem LoadedData;
+    TestTrue(TEXT("JSON container is not written"), USaveGSubSystem::WriteSaveFile(SavedData, FileName, false, false));
+    TestTrue(TEXT("JSON container is not read"), USaveGSubSystem::ReadSaveFile(FileName, LoadedData));
+    TestEqual(TEXT("Tags of the JSON container"), LoadedData.Num(), Tags.Num());
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
+    {
+        const FTagDataRef_SaveGSystem* Loaded = LoadedData.Find(Tags[Index]);
+        const bool bExactTag = Algo::AnyOf(LoadedData, [&](const auto& Pair) { return Pair.Key.Equals(Tags[Index], ESearchCase::CaseSensitive); });
+        TestTrue(FString::Printf(TEXT("Tag %i is not restored"), Index), bExactTag);
+        TestTrue(FString::Printf(TEXT("Payload of tag %i is not restored"), Index),
+            Loaded && (*Loaded)->Format == ESerializeFormat_SaveGSystem::Json && (*Loaded)->Data == SavedData[Tags[Index]]->Data);
+    }
+
+    // Characters outside the Basic Multilingual Plane may also come escaped as a surrogate pair
+    FTagDataMap_SaveGSystem EscapedData;
+    const TArray<uint8> EscapedContainer = USaveGLibrary::ConvertStringToByte(TEXT("{\"Emoji_\\ud83d\\ude00\":{}}"));
+    TestTrue(TEXT("JSON container with an escaped surrogate pair is not read"), USaveGSubSystem::DeserializeJsonContainer(EscapedContainer, EscapedData));
+    TestTrue(TEXT("Escaped surrogate pair is not decoded"), EscapedData.Num() == 1 && EscapedData.Contains(TEXT("Emoji_\U0001F600")));
+
+    // A file of the baseline format: an outer JSON object holding every payload as a pretty-printed string, one Zlib stream
+    TSharedPtr<FJsonObject> LegacyObject = MakeShared<FJsonObject>();
+    for (const FString& Tag : Tags)
+    {
+        USaveGTestStringObject* Object = NewObject<USaveGTestStringObject>();
+        Object->Generate();
+        LegacyObject->SetStringField(Tag, USaveGLibrary::SerializeObjectJson(Object));
+    }
+    TArray<uint8> LegacyBytes = USaveGLibrary::ConvertStringToByte(USaveGLibrary::ConvertJsonObjectToString(LegacyObject).TrimStartAndEnd());
+    TArray<uint8> LegacyFile;
+    {
+        FArchiveSaveCompressedProxy Compressor(LegacyFile, NAME_Zlib);
+        Compressor << LegacyBytes;
+        Compressor.Flush();
+    }
+    FFileHelper::SaveArrayToFile(LegacyFile, *FilePath);
+
+    LoadedData.Reset();
+    TestTrue(TEXT("Baseline container is not read"), USaveGSubSystem::ReadSaveFile(FileName, LoadedData));
+    for (int32 Index = 0; Index < Tags.Num(); ++Index)
+    {
+        const FTagDataRef_SaveGSystem* Loaded = LoadedData.Find(Tags[Index]);
+        USaveGTestStringObject* RestoredObject = NewObject<USaveGTestStringObject>();
+        TestTrue(FString::Printf(TEXT("Object of baseline tag %i is not restored"), Index),
+            Loaded && USaveGLibrary::DeserializeObject(RestoredObject, **Loaded) && RestoredObject->IsValidValue());
+    }
+
+    IFileManager::Get().Delete(*FilePath);
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemFileMappedReadTest, "SaveGSystem.File.MappedReadTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemFileMappedReadTest::RunTest(const FString& Parameters)
+{
+    const FString FileName = TEXT("SaveGSystemMappedReadTest");
+    const FString FilePath = FPaths::ProjectSavedDir() + TEXT("SaveGame/") + FileName + TEXT(".SaveG");
+
+    // Enough tag data for several blocks
+    FTagDataMap_SaveGSystem SavedData;
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        USaveGTestArrayNumericObject* Object = NewObject<USaveGTestArrayNumericObject>();
+        Object->Generate();
+        FTagData_SaveGSystem TagData;
+        TagData.Format = ESerializeFormat_SaveGSystem::Binary;
+        if (!TestTrue(TEXT("Object is not serialized"), USaveGLibrary::SerializeObjectBinary(Object, TagData.Data, TagData.Names))) return false;
+        SavedData.Add(FString::Printf(TEXT("TestMappedObject_%i"), Index), MakeShared<const FTagData_SaveGSystem, ESPMode::ThreadSafe>(MoveTemp(TagData)));
+    }
+    const FString PartialTag = TEXT("TestMappedObject_7");
+    const TSet<FString> PartialTags{PartialTag};
+
+    // Read the file through the mapping and through the buffered fallback, both have to hold every saved tag
+    auto TestReadBothWays = [&](const TCHAR* What)
+    {
+        FTagDataMap_SaveGSystem MappedData;
+        {
+            TUniquePtr<IMappedFileHandle> MappedHandle;
+            TUniquePtr<IMappedFileRegion> MappedRegion = USaveGSubSystem::MapSaveFile(FilePath, MappedHandle);
+            if (!TestTrue(FString::Printf(TEXT("%s is not mapped"), What), MappedRegion.IsValid())) return;
+
+            const TConstArrayView<uint8> MappedView(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize()));
+            FMemoryReaderView Reader(MappedView);
+            TestTrue(FString::Printf(TEXT("%s is not read from the mapping"), What), USaveGSubSystem::ReadSaveFileData(FileName, Reader, MappedView, MappedData, nullptr));
+            MappedRegion.Reset();
+        }
+
+        FTagDataMap_SaveGSystem BufferedData;
+        TestTrue(FString::Printf(TEXT("%s is not read through the archive"), What), USaveGSubSystem::ReadSaveFile(FileName, BufferedData, nullptr, false));
+        TestEqual(FString::Printf(TEXT("Tags of the mapped %s"), What), MappedData.Num(), SavedData.Num());
+        TestEqual(FString::Printf(TEXT("Tags of the buffered %s"), What), BufferedData.Num(), SavedData.Num());
+        for (const auto& [Tag, TagData] : SavedData)
+        {
+            const FTagDataRef_SaveGSystem* Mapped = MappedData.Find(Tag);
+            const FTagDataRef_SaveGSystem* Buffered = BufferedData.Find(Tag);
+            if (!TestTrue(FString::Printf(TEXT("%s of %s is not read both ways"), *Tag, What), Mapped && Buffered)) continue;
+            TestTrue(FString::Printf(TEXT("%s of %s differs between the reads"), *Tag, What), (*Mapped)->Data == (*Buffered)->Data && (*Mapped)->Names == (*Buffered)->Names);
+
+            USaveGTestArrayNumericObject* LoadedObject = NewObject<USaveGTestArrayNumericObject>();
+            TestTrue(FString::Printf(TEXT("Object of %s in %s is not restored"), *Tag, What), USaveGLibrary::DeserializeObject(LoadedObject, **Mapped) && LoadedObject->IsValidValue());
+        }
+
+        FTagDataMap_SaveGSystem PartialMapped;
+        FTagDataMap_SaveGSystem PartialBuffered;
+        TestTrue(FString::Printf(TEXT("Tag of %s is not read from the mapping"), What), USaveGSubSystem::ReadSaveFile(FileName, PartialMapped, &PartialTags));
+        TestTrue(FString::Printf(TEXT("Tag of %s is not read through the archive"), What), USaveGSubSystem::ReadSaveFile(FileName, PartialBuffered, &PartialTags, false));
+        TestTrue(FString::Printf(TEXT("Partial reads of %s differ"), What),
+            PartialMapped.Contains(PartialTag) && PartialBuffered.Contains(PartialTag) && PartialMapped[PartialTag]->Data == PartialBuffered[PartialTag]->Data);
+    };
+
+    TestTrue(TEXT("Indexed file is not written"), USaveGSubSystem::WriteSaveFile(SavedData, FileName, true, false));
+    TestReadBothWays(TEXT("indexed file"));
+
+    // A file of an older version: the binary container as one Zlib stream, copied once for the proxy also when it is mapped
+    TArray<uint8> LegacyBytes;
+    USaveGSubSystem::SerializeBinaryContainer(SavedData, LegacyBytes);
+    TArray<uint8> LegacyFile;
+    {
+        FArchiveSaveCompressedProxy Compressor(LegacyFile, NAME_Zlib);
+        Compressor << LegacyBytes;
+        Compressor.Flush();
+    }
+    FFileHelper::SaveArrayToFile(LegacyFile, *FilePath);
+    TestReadBothWays(TEXT("legacy file"));
+
+    IFileManager::Get().Delete(*FilePath);
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemBinaryBoolParityTest, "SaveGSystem.Binary.BoolParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryBoolParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestBoolObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemBinaryByteParityTest, "SaveGSystem.Binary.ByteParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryByteParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestByteObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSaveGSystemBinaryNumericParityTest, "SaveGSystem.Binary.NumericParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryNumericParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestNumericObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSaveGSystemBinaryStringParityTest, "SaveGSystem.Binary.StringParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryStringParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestStringObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSaveGSystemBinaryObjectParityTest, "SaveGSystem.Binary.ObjectParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryObjectParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestObjectHandle>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSaveGSystemBinaryStructParityTest, "SaveGSystem.Binary.StructParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryStructParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestStructObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSaveGSystemBinaryArrayStructParityTest, "SaveGSystem.Binary.ArrayStructParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryArrayStructParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestArrayStructObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FSaveGSystemBinaryArrayNumericParityTest, "SaveGSystem.Binary.ArrayNumericParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryArrayNumericParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestArrayNumericObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemBinaryMapParityTest, "SaveGSystem.Binary.MapParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryMapParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestMapStructObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemBinarySetParityTest, "SaveGSystem.Binary.SetParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinarySetParityTest::RunTest(const FString& Parameters)
+{
+    return SaveGSystemTests::RunSaveGSystemFormatParityTest<USaveGTestSetObject>(this);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemBinaryNameTableTest, "SaveGSystem.Binary.NameTableTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryNameTableTest::RunTest(const FString& Parameters)
+{
+    TArray<uint8> Data;
+    TArray<FName> Names;
+    {
+        FSaveGNameTableWriter Writer(Data, Names);
+        for (FName Name : {FName(TEXT("Health")), FName(TEXT("Actor"), 3), FName(TEXT("Health")), FName(TEXT("Actor"), 3)})
+        {
+            Writer << Name;
+        }
+    }
+    TestEqual(TEXT("Repeated names should be written to the table once"), Names.Num(), 2);
+    TestEqual(TEXT("Small name indices should take one byte each"), Data.Num(), 4);
+
+    FSaveGNameTableReader Reader(Data, Names);
+    FName First, Second, Third, Fourth;
+    Reader << First << Second << Third << Fourth;
+    TestFalse(TEXT("Reader should not be in the error state"), Reader.IsError());
+    TestEqual(TEXT("Name should be resolved from the table"), First, FName(TEXT("Health")));
+    TestEqual(TEXT("Name number should be kept"), Second, FName(TEXT("Actor"), 3));
+    TestEqual(TEXT("Repeated name should be resolved from the table"), Fourth, FName(TEXT("Actor"), 3));
+
+    // An index outside of the table marks the data as corrupted
+    const TArray<FName> EmptyNames;
+    FSaveGNameTableReader InvalidReader(Data, EmptyNames);
+    FName Invalid;
+    InvalidReader << Invalid;
+    TestTrue(TEXT("Reader should be in the error state for an unknown index"), InvalidReader.IsError());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemBinarySkipDefaultsTest, "SaveGSystem.Binary.SkipDefaultsTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinarySkipDefaultsTest::RunTest(const FString& Parameters)
+{
+    // Only one property differs from the class default object
+    USaveGTestNumericObject* SourceObject = NewObject<USaveGTestNumericObject>();
+    USaveGTestNumericObject* TargetObject = NewObject<USaveGTestNumericObject>();
+    FIntProperty* Int32Property = FindFProperty<FIntProperty>(USaveGTestNumericObject::StaticClass(), TEXT("Int32"));
+    FDoubleProperty* DoubleProperty = FindFProperty<FDoubleProperty>(USaveGTestNumericObject::StaticClass(), TEXT("Double"));
+    if (!TestTrue(TEXT("Test objects are not created"), SourceObject && TargetObject && Int32Property && DoubleProperty)) return false;
+    Int32Property->SetPropertyValue_InContainer(SourceObject, 42);
+
+    FTagData_SaveGSystem FullData;
+    FTagData_SaveGSystem DeltaData;
+    FullData.Format = DeltaData.Format = ESerializeFormat_SaveGSystem::Binary;
+    DeltaData.bSkipDefaultValues = true;
+    TestTrue(TEXT("Full serialization failed"), USaveGLibrary::SerializeObject(SourceObject, FullData));
+    TestTrue(TEXT("Delta serialization failed"), USaveGLibrary::SerializeObject(SourceObject, DeltaData));
+    TestTrue(TEXT("Delta data should be smaller than full data"), DeltaData.Data.Num() < FullData.Data.Num());
+    AddInfo(FString::Printf(TEXT("Full bytes: %i | Delta bytes: %i"), FullData.Data.Num(), DeltaData.Data.Num()));
+
+    // Omitted properties are reset to the defaults, not left at their current values
+    TargetObject->Generate();
+    TestTrue(TEXT("Delta deserialization failed"), USaveGLibrary::DeserializeObject(TargetObject, DeltaData));
+    TestEqual(TEXT("Saved property should be loaded"), Int32Property->GetPropertyValue_InContainer(TargetObject), 42);
+    TestEqual(TEXT("Omitted property should be reset to the default"), DoubleProperty->GetPropertyValue_InContainer(TargetObject), 0.0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemBinaryColumnarSkipDefaultsTest, "SaveGSystem.Binary.ColumnarSkipDefaultsTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemBinaryColumnarSkipDefaultsTest::RunTest(const FString& Parameters)
+{
+    // Only one field of one element differs from the struct defaults, every other column is omitted
+    USaveGTestArrayStructObject* SourceObject = NewObject<USaveGTestArrayStructObject>();
+    USaveGTestArrayStructObject* TargetObject = NewObject<USaveGTestArrayStructObject>();
+    FArrayProperty* ArrayProperty = FindFProperty<FArrayProperty>(USaveGTestArrayStructObject::StaticClass(), TEXT("ArrayStruct"));
+    FIntProperty* Int32Property = FindFProperty<FIntProperty>(FTestStructObject::StaticStruct(), TEXT("Int32"));
+    FDoubleProperty* DoubleProperty = FindFProperty<FDoubleProperty>(FTestStructObject::StaticStruct(), TEXT("Double"));
+    if (!TestTrue(TEXT("Test objects are not created"), SourceObject && TargetObject && ArrayProperty && Int32Property && DoubleProperty)) return false;
+    FScriptArrayHelper SourceHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(SourceObject));
+    SourceHelper.AddValues(3);
+    Int32Property->SetPropertyValue_InContainer(SourceHelper.GetRawPtr(1), 42);
+
+    FTagData_SaveGSystem DeltaData;
+    DeltaData.Format = ESerializeFormat_SaveGSystem::Binary;
+    DeltaData.bSkipDefaultValues = true;
+    TestTrue(TEXT("Delta serialization failed"), USaveGLibrary::SerializeObject(SourceObject, DeltaData));
+
+    TargetObject->Generate();
+    TestTrue(TEXT("Delta deserialization failed"), USaveGLibrary::DeserializeObject(TargetObject, DeltaData));
+    FScriptArrayHelper TargetHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(TargetObject));
+    if (!TestEqual(TEXT("Array size should be loaded"), TargetHelper.Num(), 3)) return false;
+    TestEqual(TEXT("Saved column should be loaded"), Int32Property->GetPropertyValue_InContainer(TargetHelper.GetRawPtr(1)), 42);
+    TestEqual(TEXT("Saved column should keep default elements"), Int32Property->GetPropertyValue_InContainer(TargetHelper.GetRawPtr(0)), 0);
+    TestEqual(TEXT("Omitted column should be reset to the default"), DoubleProperty->GetPropertyValue_InContainer(TargetHelper.GetRawPtr(2)), 0.0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemSnapshotParityTest, "SaveGSystem.Snapshot.ParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemSnapshotParityTest::RunTest(const FString& Parameters)
+{
+    USaveGTestArrayStructObject* SourceObject = NewObject<USaveGTestArrayStructObject>();
+    if (!TestNotNull(TEXT("Test object is not created"), SourceObject)) return false;
+    SourceObject->Generate();
+
+    for (const ESerializeFormat_SaveGSystem Format : {ESerializeFormat_SaveGSystem::Json, ESerializeFormat_SaveGSystem::Binary})
+    {
+        FTagData_SaveGSystem ObjectData;
+        FTagData_SaveGSystem SnapshotData;
+        ObjectData.Format = SnapshotData.Format = Format;
+        TestTrue(TEXT("Object serialization failed"), USaveGLibrary::SerializeObject(SourceObject, ObjectData));
+
+        // The snapshot keeps the values it was taken with, whatever happens to the object afterwards
+        const FSaveGPropertySnapshot Snapshot(SourceObject);
+        SourceObject->Reset();
+        TestTrue(TEXT("Snapshot serialization failed"), USaveGLibrary::SerializeSnapshot(Snapshot, SnapshotData));
+        TestTrue(TEXT("Snapshot data differs from object data"), SnapshotData.Data == ObjectData.Data && SnapshotData.Names == ObjectData.Names);
+        SourceObject->Generate();
+    }
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemSnapshotUnloadedSoftObjectTest, "SaveGSystem.Snapshot.UnloadedSoftObjectTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemSnapshotUnloadedSoftObjectTest::RunTest(const FString& Parameters)
+{
+    // The asset does not exist, so the reference can never resolve and only its path can be saved
+    const FSoftObjectPath UnloadedPath(TEXT("/Game/SaveGSystemTests/Unloaded.Unloaded"));
+    USaveGTestObjectHandle* SourceObject = NewObject<USaveGTestObjectHandle>();
+    FSoftObjectProperty* SoftObjectProperty = FindFProperty<FSoftObjectProperty>(USaveGTestObjectHandle::StaticClass(), TEXT("SoftObject"));
+    if (!TestTrue(TEXT("Test object is not created"), SourceObject && SoftObjectProperty)) return false;
+    SoftObjectProperty->SetPropertyValue_InContainer(SourceObject, FSoftObjectPtr(UnloadedPath));
+
+    for (const ESerializeFormat_SaveGSystem Format : {ESerializeFormat_SaveGSystem::Json, ESerializeFormat_SaveGSystem::Binary})
+    {
+        FTagData_SaveGSystem SnapshotData;
+        SnapshotData.Format = Format;
+        const FSaveGPropertySnapshot Snapshot(SourceObject);
+        TestTrue(TEXT("Snapshot serialization failed"), USaveGLibrary::SerializeSnapshot(Snapshot, SnapshotData));
+
+        USaveGTestObjectHandle* TargetObject = NewObject<USaveGTestObjectHandle>();
+        TestTrue(TEXT("Deserialization failed"), USaveGLibrary::DeserializeObject(TargetObject, SnapshotData));
+        TestEqual(TEXT("Unloaded soft reference should keep its path"), SoftObjectProperty->GetPropertyValue_InContainer(TargetObject).ToString(), UnloadedPath.ToString());
+    }
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemJsonStreamParityTest, "SaveGSystem.Json.StreamParityTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemJsonStreamParityTest::RunTest(const FString& Parameters)
+{
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestByteObject>(this);
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestNumericObject>(this);
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestStringObject>(this);
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestObjectHandle>(this);
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestArrayStructObject>(this);
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestSetObject>(this);
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestArrayNumericObject>(this);
+    SaveGSystemTests::RunSaveGSystemJsonStreamParityTest<USaveGTestMapStructObject>(this);
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemJsonWriterBenchmark, "SaveGSystem.Benchmark.JsonWriter", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FSaveGSystemJsonWriterBenchmark::RunTest(const FString& Parameters)
+{
+    constexpr int32 Iterations = 200;
+    USaveGTestMapStructObject* TestObject = NewObject<USaveGTestMapStructObject>();
+    if (!TestNotNull(TEXT("TestObject is nullptr"), TestObject)) return false;
+    TestObject->Generate();
+
+    // Object tree path as it was used before: build the tree, print it to a wide string, convert to UTF-8
+    TArray<uint8> TreeData;
+    const double TreeStart = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        TreeData = USaveGLibrary::ConvertStringToByte(USaveGLibrary::SerializeObjectJson(TestObject));
+    }
+    const double TreeTime = FPlatformTime::Seconds() - TreeStart;
+
+    TArray<uint8> StreamData;
+    const double StreamStart = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        USaveGLibrary::SerializeObjectJson(TestObject, StreamData);
+    }
+    const double StreamTime = FPlatformTime::Seconds() - StreamStart;
+
+    AddInfo(FString::Printf(TEXT("JSON tree: %.3f ms per object, %i bytes"), TreeTime * 1000.0 / Iterations, TreeData.Num()));
+    AddInfo(FString::Printf(TEXT("JSON stream: %.3f ms per object, %i bytes"), StreamTime * 1000.0 / Iterations, StreamData.Num()));
+    TestTrue(TEXT("Streamed JSON should not be larger than the pretty printed tree"), StreamData.Num() <= TreeData.Num());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemPropertyPlanCache, "SaveGSystem.Plan.Cache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemPropertyPlanCache::RunTest(const FString& Parameters)
+{
+    // Classes contribute only SaveGame properties
+    const FSaveGPropertyPlanRef ClassPlan = FSaveGPropertyPlan::Get(USaveGTestNumericObject::StaticClass());
+    TestEqual(TEXT("Class plan should contain only SaveGame properties"), ClassPlan->GetEntries().Num(), 9);
+    TestNotNull(TEXT("Class plan should find a property by name"), ClassPlan->FindEntry(TEXT("Double")));
+    TestNull(TEXT("Class plan should not contain properties without the SaveGame flag"), ClassPlan->FindEntry(TEXT("bActionPreSave")));
+
+    // Structs contribute all reflected properties
+    const FSaveGPropertyPlanRef StructPlan = FSaveGPropertyPlan::Get(FTestStructObject::StaticStruct());
+    TestEqual(TEXT("Struct plan should contain all reflected properties"), StructPlan->GetEntries().Num(), 19);
+
+    // Only structs made of plain fields are copied as raw memory
+    TestTrue(TEXT("Plain struct should be bulk copyable"), FSaveGPropertyPlan::Get(TBaseStructure<FVector>::Get())->IsBulkCopyable());
+    TestFalse(TEXT("Struct with strings should not be bulk copyable"), StructPlan->IsBulkCopyable());
+
+    // Saved data is dropped when the layout hash differs, so it must not change between runs or builds
+    TestEqual(TEXT("Layout hash of FVector should be stable"), FSaveGPropertyPlan::Get(TBaseStructure<FVector>::Get())->GetLayoutHash(), 0xDC40E78Fu);
+
+    // Plans are built once and rebuilt after invalidation
+    TestTrue(TEXT("Plan should be cached"), &ClassPlan.Get() == &FSaveGPropertyPlan::Get(USaveGTestNumericObject::StaticClass()).Get());
+    FSaveGPropertyPlan::Invalidate();
+    TestTrue(TEXT("Plan should be rebuilt after invalidation"), &ClassPlan.Get() != &FSaveGPropertyPlan::Get(USaveGTestNumericObject::StaticClass()).Get());
+
+    return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemConvertToString, "SaveGSystem.Convert.ToString", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
 bool FSaveGSystemConvertToString::RunTest(const FString& Parameters)
@@ -216,4 +1123,151 @@ bool FSaveGSystemZlibDecompression::RunTest(const FString& Parameters)
 
     return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemChunkedCompressionTest, "SaveGSystem.Compression.ChunkedTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FSaveGSystemChunkedCompressionTest::RunTest(const FString& Parameters)
+{
+    // Sizes around the chunk boundaries and an empty payload
+    const int32 ChunkSize = SaveGSystemSpace::CompressionChunkSize;
+    FRandomStream Random(42);
+    for (const int32 Size : {0, 1, ChunkSize - 1, ChunkSize, ChunkSize + 1, ChunkSize * 3 + 17})
+    {
+        TArray<uint8> OriginalData;
+        OriginalData.SetNumUninitialized(Size);
+        for (int32 Index = 0; Index < Size; ++Index)
+        {
+            OriginalData[Index] = static_cast<uint8>(Random.RandRange(0, 15) + Index % 7);
+        }
+
+        // Every codec, the codec is read back from the data
+        for (const ECompressionCodec_SaveGSystem Codec : TEnumRange<ECompressionCodec_SaveGSystem>())
+        {
+            const FString CodecName = UEnum::GetDisplayValueAsText(Codec).ToString();
+            TArray<uint8> CompressedData;
+            TArray<uint8> DecompressedData;
+            TestTrue(FString::Printf(TEXT("Compress %i bytes with %s"), Size, *CodecName),
+                USaveGLibrary::CompressDataParallel(OriginalData, CompressedData, Codec, ECompressionLevel_SaveGSystem::Fastest, 4));
+            TestTrue(FString::Printf(TEXT("Decompress %i bytes with %s"), Size, *CodecName), USaveGLibrary::DecompressDataParallel(CompressedData, DecompressedData, 2));
+            TestTrue(FString::Printf(TEXT("Round trip of %i bytes with %s"), Size, *CodecName), DecompressedData == OriginalData);
+        }
+    }
+
+    // Data of the first chunked version has no codec and flags and is always Zlib
+    {
+        TArray<uint8> OriginalData = USaveGLibrary::ConvertStringToByte(FString::ChrN(1024, TEXT('G')));
+        TArray<uint8> CompressedData;
+        USaveGLibrary::CompressDataParallel(OriginalData, CompressedData, ECompressionCodec_SaveGSystem::Zlib);
+        CompressedData[sizeof(uint32)] = 1;
+        CompressedData.RemoveAt(SaveGSystemSpace::CompressedCodecOffset, 2);
+        TArray<uint8> DecompressedData;
+        TestTrue(TEXT("Version 1 data is not decompressed"), USaveGLibrary::DecompressData(CompressedData, DecompressedData) && DecompressedData == OriginalData);
+    }
+
+    // Incompressible data is stored raw behind the header
+    {
+        TArray<uint8> OriginalData;
+        OriginalData.SetNumUninitialized(ChunkSize + 100);
+        for (uint8& Byte : OriginalData)
+        {
+            Byte = static_cast<uint8>(Random.RandHelper(256));
+        }
+        TArray<uint8> CompressedData;
+        TArray<uint8> DecompressedData;
+        USaveGLibrary::CompressDataParallel(OriginalData, CompressedData, ECompressionCodec_SaveGSystem::Zlib);
+        const int32 FlagsOffset = sizeof(uint32) + sizeof(uint16) + sizeof(uint8);
+        TestTrue(TEXT("Incompressible data is not stored raw"), CompressedData[FlagsOffset] == SaveGSystemSpace::CompressedRawFlag &&
+                                                                   CompressedData.Num() < OriginalData.Num() + 32);
+        TestTrue(TEXT("Raw data is not restored"), USaveGLibrary::DecompressData(CompressedData, DecompressedData) && DecompressedData == OriginalData);
+    }
+
+    // Files of older versions hold a single Zlib stream
+    TArray<uint8> OriginalData = USaveGLibrary::ConvertStringToByte(TEXT("Legacy compressed stream"));
+    TArray<uint8> LegacyData;
+    {
+        FArchiveSaveCompressedProxy Compressor(LegacyData, NAME_Zlib);
+        Compressor << OriginalData;
+        Compressor.Flush();
+    }
+    TArray<uint8> DecompressedData;
+    TestTrue(TEXT("Legacy stream is not decompressed"), USaveGLibrary::DecompressData(LegacyData, DecompressedData) && DecompressedData == OriginalData);
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemChunkedCompressionBenchmark, "SaveGSystem.Benchmark.ChunkedCompression", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FSaveGSystemChunkedCompressionBenchmark::RunTest(const FString& Parameters)
+{
+    // A world-sized payload with the mix of repeated and noisy bytes typical for binary saves
+    constexpr int32 PayloadSize = 32 * 1024 * 1024;
+    FRandomStream Random(7);
+    TArray<uint8> OriginalData;
+    OriginalData.SetNumUninitialized(PayloadSize);
+    for (int32 Index = 0; Index < PayloadSize; ++Index)
+    {
+        OriginalData[Index] = Index % 16 < 10 ? static_cast<uint8>(Index % 16) : static_cast<uint8>(Random.RandHelper(256));
+    }
+
+    const double SizeMB = PayloadSize / (1024.0 * 1024.0);
+    for (const int32 NumWorkers : {1, 2, 4, 8})
+    {
+        TArray<uint8> CompressedData;
+        TArray<uint8> DecompressedData;
+        double StartTime = FPlatformTime::Seconds();
+        const bool bCompressed = USaveGLibrary::CompressDataParallel(OriginalData, CompressedData, ECompressionCodec_SaveGSystem::Zlib, ECompressionLevel_SaveGSystem::Normal, NumWorkers);
+        const double CompressTime = FPlatformTime::Seconds() - StartTime;
+
+        StartTime = FPlatformTime::Seconds();
+        const bool bDecompressed = USaveGLibrary::DecompressDataParallel(CompressedData, DecompressedData, NumWorkers);
+        const double DecompressTime = FPlatformTime::Seconds() - StartTime;
+
+        TestTrue(FString::Printf(TEXT("Round trip with %i workers"), NumWorkers), bCompressed && bDecompressed && DecompressedData == OriginalData);
+        AddInfo(FString::Printf(TEXT("Workers: %i | Compress: %.1f MB/s | Decompress: %.1f MB/s | Ratio: %.3f"), NumWorkers, SizeMB / CompressTime,
+            SizeMB / DecompressTime, static_cast<double>(CompressedData.Num()) / PayloadSize));
+    }
+    return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGSystemCompressionCodecBenchmark, "SaveGSystem.Benchmark.CompressionCodecs", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FSaveGSystemCompressionCodecBenchmark::RunTest(const FString& Parameters)
+{
+    // A sample save made of the binary encodings of the test objects
+    constexpr int32 PayloadSize = 16 * 1024 * 1024;
+    const TArray<UClass*> Classes{USaveGTestNumericObject::StaticClass(), USaveGTestStringObject::StaticClass(), USaveGTestArrayStructObject::StaticClass(),
+        USaveGTestArrayNumericObject::StaticClass(), USaveGTestSetObject::StaticClass()};
+    TArray<uint8> OriginalData;
+    while (OriginalData.Num() < PayloadSize)
+    {
+        for (UClass* Class : Classes)
+        {
+            USaveGBaseTestObject* Object = NewObject<USaveGBaseTestObject>(GetTransientPackage(), Class);
+            Object->Generate();
+            TArray<uint8> ObjectData;
+            TArray<FName> Names;
+            if (!TestTrue(FString::Printf(TEXT("Serialize %s"), *Class->GetName()), USaveGLibrary::SerializeObjectBinary(Object, ObjectData, Names))) return false;
+            OriginalData.Append(ObjectData);
+        }
+    }
+
+    const double SizeMB = OriginalData.Num() / (1024.0 * 1024.0);
+    for (const ECompressionCodec_SaveGSystem Codec : TEnumRange<ECompressionCodec_SaveGSystem>())
+    {
+        for (const ECompressionLevel_SaveGSystem Level : TEnumRange<ECompressionLevel_SaveGSystem>())
+        {
+            const FString Name = FString::Printf(TEXT("%s %s"), *UEnum::GetDisplayValueAsText(Codec).ToString(), *UEnum::GetDisplayValueAsText(Level).ToString());
+            TArray<uint8> CompressedData;
+            TArray<uint8> DecompressedData;
+            double StartTime = FPlatformTime::Seconds();
+            const bool bCompressed = USaveGLibrary::CompressDataParallel(OriginalData, CompressedData, Codec, Level);
+            const double CompressTime = FPlatformTime::Seconds() - StartTime;
+
+            StartTime = FPlatformTime::Seconds();
+            const bool bDecompressed = USaveGLibrary::DecompressDataParallel(CompressedData, DecompressedData);
+            const double DecompressTime = FPlatformTime::Seconds() - StartTime;
+
+            TestTrue(FString::Printf(TEXT("Round trip with %s"), *Name), bCompressed && bDecompressed && DecompressedData == OriginalData);
+            AddInfo(FString::Printf(TEXT("%s | Compress: %.1f MB/s | Decompress: %.1f MB/s | Ratio: %.3f"), *Name, SizeMB / CompressTime, SizeMB / DecompressTime,
+                static_cast<double>(CompressedData.Num()) / OriginalData.Num()));
+        }
+    }
+    return !HasAnyErrors();
+}
 #endif
\ No newline at end of file
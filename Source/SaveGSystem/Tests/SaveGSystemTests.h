@@ -4,6 +4,7 @@
 #if WITH_AUTOMATION_TESTS
 
 #include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
 #include "Misc/AutomationTest.h"
 #include "SaveGSystem/Interface/SaveGInterface.h"
 #include "SaveGSystem/SubSystem/SaveGSubSystem.h"
@@ -65,6 +66,10 @@ public:
         {
             ++GFrameCounter;
             WeakWorld->Tick(LEVELTICK_All, DeltaTime);
+            // The save subsystem pumps its queue from the core ticker, which the engine loop ticks every frame
+            FTSTicker::GetCoreTicker().Tick(DeltaTime);
+            // Results of worker threads are handed back as game thread tasks, which a real frame would process
+            FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
             ElapsedTime += DeltaTime;
             if (bBreak)
             {
@@ -174,6 +179,37 @@ public:
     virtual void Reset() {}
 };
 
+UCLASS()
+class SAVEGSYSTEM_API ASaveGTestActor : public AActor, public ISaveGInterface
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(SaveGame)
+    int32 Value{0};
+};
+
+UCLASS()
+class SAVEGSYSTEM_API USaveGTestWorldListener : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    float LastProgress{-1.0f};
+    int32 NumCompleted{0};
+    int32 NumActors{0};
+
+    UFUNCTION()
+    void OnProgress(float Progress) { LastProgress = Progress; }
+
+    UFUNCTION()
+    void OnComplete(bool bSave, int32 InNumActors)
+    {
+        ++NumCompleted;
+        NumActors = InNumActors;
+    }
+};
+
 UCLASS()
 class SAVEGSYSTEM_API USaveGTestBoolObject : public USaveGBaseTestObject
 {
@@ -612,6 +648,128 @@ public:
     }
 };
 
+UCLASS()
+class SAVEGSYSTEM_API USaveGTestArrayNumericObject : public USaveGBaseTestObject
+{
+    GENERATED_BODY()
+
+private:
+    UPROPERTY(SaveGame)
+    TArray<bool> ArrayBool{};
+
+    UPROPERTY(SaveGame)
+    TArray<ETestEnumObject> ArrayEnum{};
+
+    UPROPERTY(SaveGame)
+    TArray<int64> ArrayInt64{};
+
+    UPROPERTY(SaveGame)
+    TArray<float> ArrayFloat{};
+
+    UPROPERTY(SaveGame)
+    TArray<FVector> ArrayVector{};
+
+    UPROPERTY(SaveGame)
+    TArray<FIntPoint> ArrayIntPoint{};
+
+public:
+    virtual void Generate() override
+    {
+        for (int32 i = 1; i <= 64; i++)
+        {
+            ArrayBool.Add(i % 2 == 0);
+            ArrayEnum.Add(static_cast<ETestEnumObject>(i % 3 + 1));
+            ArrayInt64.Add(static_cast<int64>(i) * INT32_MAX);
+            ArrayFloat.Add(i * 0.5f);
+            ArrayVector.Add(FVector(i, -i, i * 0.25));
+            ArrayIntPoint.Add(FIntPoint(i, -i));
+        }
+    }
+    virtual bool IsValidValue() override
+    {
+        if (ArrayBool.Num() != 64 || ArrayEnum.Num() != 64 || ArrayInt64.Num() != 64) return false;
+        if (ArrayFloat.Num() != 64 || ArrayVector.Num() != 64 || ArrayIntPoint.Num() != 64) return false;
+        for (int32 i = 1; i <= 64; i++)
+        {
+            const int32 Index = i - 1;
+            if (ArrayBool[Index] != (i % 2 == 0)) return false;
+            if (ArrayEnum[Index] != static_cast<ETestEnumObject>(i % 3 + 1)) return false;
+            if (ArrayInt64[Index] != static_cast<int64>(i) * INT32_MAX) return false;
+            if (ArrayFloat[Index] != i * 0.5f) return false;
+            if (ArrayVector[Index] != FVector(i, -i, i * 0.25)) return false;
+            if (ArrayIntPoint[Index] != FIntPoint(i, -i)) return false;
+        }
+        return true;
+    }
+    virtual void Reset() override
+    {
+        ArrayBool.Empty();
+        ArrayEnum.Empty();
+        ArrayInt64.Empty();
+        ArrayFloat.Empty();
+        ArrayVector.Empty();
+        ArrayIntPoint.Empty();
+    }
+};
+
+UCLASS()
+class SAVEGSYSTEM_API USaveGTestSetObject : public USaveGBaseTestObject
+{
+    GENERATED_BODY()
+
+private:
+    UPROPERTY(SaveGame)
+    TSet<int32> SetInt32{};
+
+    UPROPERTY(SaveGame)
+    TSet<FName> SetName{};
+
+    UPROPERTY(SaveGame)
+    TSet<FString> SetString{};
+
+    UPROPERTY(SaveGame)
+    TSet<FIntPoint> SetIntPoint{};
+
+    UPROPERTY(SaveGame)
+    TMap<FIntPoint, int32> MapIntPoint{};
+
+public:
+    virtual void Generate() override
+    {
+        for (int32 i = 1; i <= 64; i++)
+        {
+            SetInt32.Add(i * 3);
+            SetName.Add(FName(FString::Printf(TEXT("Name_%i"), i)));
+            SetString.Add(FString::Printf(TEXT("String_%i"), i));
+            SetIntPoint.Add(FIntPoint(i, -i));
+            MapIntPoint.Add(FIntPoint(-i, i), i * 7);
+        }
+    }
+    virtual bool IsValidValue() override
+    {
+        if (SetInt32.Num() != 64 || SetName.Num() != 64 || SetString.Num() != 64) return false;
+        if (SetIntPoint.Num() != 64 || MapIntPoint.Num() != 64) return false;
+        for (int32 i = 1; i <= 64; i++)
+        {
+            if (!SetInt32.Contains(i * 3)) return false;
+            if (!SetName.Contains(FName(FString::Printf(TEXT("Name_%i"), i)))) return false;
+            if (!SetString.Contains(FString::Printf(TEXT("String_%i"), i))) return false;
+            if (!SetIntPoint.Contains(FIntPoint(i, -i))) return false;
+            const int32* Value = MapIntPoint.Find(FIntPoint(-i, i));
+            if (!Value || *Value != i * 7) return false;
+        }
+        return true;
+    }
+    virtual void Reset() override
+    {
+        SetInt32.Empty();
+        SetName.Empty();
+        SetString.Empty();
+        SetIntPoint.Empty();
+        MapIntPoint.Empty();
+    }
+};
+
 UCLASS()
 class SAVEGSYSTEM_API USaveGTestMapStructObject : public USaveGBaseTestObject
 {